@@ -0,0 +1,259 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/cow_tree.hpp"
+// fcarouge::cow_tree
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_execution.hpp"
+// fcarouge::par
+
+#include <benchmark/benchmark.h>
+// BENCHMARK benchmark::ClobberMemory benchmark::DoNotOptimize
+// benchmark::kNanosecond benchmark::State
+
+#include <cassert>
+// assert
+
+#include <chrono>
+// std::chrono::duration_cast std::chrono::high_resolution_clock
+// benchmark::oAuto
+
+#include <cstdint>
+// std::int64_t std::uint64_t
+
+#include <random>
+// std::mt19937_64 std::uniform_int_distribution
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @brief Builds a bushy container of the given size by random pushes.
+fcarouge::tree<double> bushy(std::int64_t size)
+{
+  fcarouge::tree<double> lyons_beech;
+  std::vector<fcarouge::tree<double>::iterator> positions;
+  std::mt19937_64 generator{ 42 };
+  for (std::int64_t i = 0; i < size; ++i) {
+    if (positions.empty()) {
+      positions.push_back(lyons_beech.emplace(lyons_beech.end(), 0.));
+    } else {
+      std::uniform_int_distribution<std::size_t> distribution{
+        0, positions.size() - 1
+      };
+      positions.push_back(lyons_beech.push(positions[distribution(generator)],
+                                           static_cast<double>(i)));
+    }
+  }
+
+  return lyons_beech;
+}
+
+//! @benchmark Measure the performance of the sequenced copy construction.
+void copy_sequenced(benchmark::State &state)
+{
+  const auto lyons_beech{ bushy(state.range(0)) };
+  assert(state.range(0) == lyons_beech.size() &&
+         "The size of the container does not meet expectations.");
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const fcarouge::tree<double> copy{ lyons_beech };
+    benchmark::DoNotOptimize(copy);
+
+    auto end = std::chrono::high_resolution_clock::now();
+    state.SetIterationTime(
+        std::chrono::duration_cast<std::chrono::duration<double>>(end - start)
+            .count());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+//! @benchmark Measure the performance of the copy construction of a copy,
+//! copied in bulk.
+void copy_packed(benchmark::State &state)
+{
+  const auto bushy_beech{ bushy(state.range(0)) };
+  const fcarouge::tree<double> lyons_beech{ bushy_beech };
+  assert(state.range(0) == lyons_beech.size() &&
+         "The size of the container does not meet expectations.");
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const fcarouge::tree<double> copy{ lyons_beech };
+    benchmark::DoNotOptimize(copy);
+
+    auto end = std::chrono::high_resolution_clock::now();
+    state.SetIterationTime(
+        std::chrono::duration_cast<std::chrono::duration<double>>(end - start)
+            .count());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+//! @benchmark Measure the performance of the parallel copy construction.
+void copy_parallel(benchmark::State &state)
+{
+  const auto lyons_beech{ bushy(state.range(0)) };
+  assert(state.range(0) == lyons_beech.size() &&
+         "The size of the container does not meet expectations.");
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const fcarouge::tree<double> copy{ fcarouge::par, lyons_beech };
+    benchmark::DoNotOptimize(copy);
+
+    auto end = std::chrono::high_resolution_clock::now();
+    state.SetIterationTime(
+        std::chrono::duration_cast<std::chrono::duration<double>>(end - start)
+            .count());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+//! @benchmark Measure the performance of the copy construction of a
+//! copy-on-write container and the modification of its root.
+void copy_on_write(benchmark::State &state)
+{
+  const fcarouge::cow_tree<double> lyons_holly{ bushy(state.range(0)) };
+  assert(state.range(0) == lyons_holly.size() &&
+         "The size of the container does not meet expectations.");
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    auto start = std::chrono::high_resolution_clock::now();
+
+    fcarouge::cow_tree<double> copy{ lyons_holly };
+    if (!copy.empty()) {
+      copy.modify(copy.begin(), [](double &value) { ++value; });
+    }
+    benchmark::DoNotOptimize(copy);
+
+    auto end = std::chrono::high_resolution_clock::now();
+    state.SetIterationTime(
+        std::chrono::duration_cast<std::chrono::duration<double>>(end - start)
+            .count());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(copy_sequenced)
+    ->Name("copy_sequenced")
+    ->Unit(benchmark::kNanosecond)
+    ->ComputeStatistics("min",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::min_element(std::begin(v), std::end(v)));
+                        })
+    ->ComputeStatistics("max",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::max_element(std::begin(v), std::end(v)));
+                        })
+    ->Arg(0)
+    ->UseManualTime()
+    ->Complexity(benchmark::oAuto)
+    ->DisplayAggregatesOnly(true)
+    ->RangeMultiplier(2)
+    ->Repetitions(10)
+    ->Range(1, 1 << 20);
+
+BENCHMARK(copy_packed)
+    ->Name("copy_packed")
+    ->Unit(benchmark::kNanosecond)
+    ->ComputeStatistics("min",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::min_element(std::begin(v), std::end(v)));
+                        })
+    ->ComputeStatistics("max",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::max_element(std::begin(v), std::end(v)));
+                        })
+    ->Arg(0)
+    ->UseManualTime()
+    ->Complexity(benchmark::oAuto)
+    ->DisplayAggregatesOnly(true)
+    ->RangeMultiplier(2)
+    ->Repetitions(10)
+    ->Range(1, 1 << 20);
+
+BENCHMARK(copy_parallel)
+    ->Name("copy_parallel")
+    ->Unit(benchmark::kNanosecond)
+    ->ComputeStatistics("min",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::min_element(std::begin(v), std::end(v)));
+                        })
+    ->ComputeStatistics("max",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::max_element(std::begin(v), std::end(v)));
+                        })
+    ->Arg(0)
+    ->UseManualTime()
+    ->Complexity(benchmark::oAuto)
+    ->DisplayAggregatesOnly(true)
+    ->RangeMultiplier(2)
+    ->Repetitions(10)
+    ->Range(1, 1 << 20);
+
+BENCHMARK(copy_on_write)
+    ->Name("copy_on_write")
+    ->Unit(benchmark::kNanosecond)
+    ->ComputeStatistics("min",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::min_element(std::begin(v), std::end(v)));
+                        })
+    ->ComputeStatistics("max",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::max_element(std::begin(v), std::end(v)));
+                        })
+    ->Arg(0)
+    ->UseManualTime()
+    ->Complexity(benchmark::oAuto)
+    ->DisplayAggregatesOnly(true)
+    ->RangeMultiplier(2)
+    ->Repetitions(10)
+    ->Range(1, 1 << 20);
+
+} // namespace
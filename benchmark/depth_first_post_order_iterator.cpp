@@ -0,0 +1,177 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_iterator.hpp"
+// fcarouge::post_order_begin fcarouge::post_order_end
+
+#include <benchmark/benchmark.h>
+// BENCHMARK benchmark::ClobberMemory benchmark::DoNotOptimize
+// benchmark::kNanosecond benchmark::State
+
+#include <cassert>
+// assert
+
+#include <chrono>
+// std::chrono::duration_cast std::chrono::high_resolution_clock
+// benchmark::oAuto
+
+#include <cstdint>
+// std::uint64_t
+
+namespace
+{
+//! @brief Builds a deep container of the given size.
+//!
+//! @details Every node of the spine has a leaf first child and the next spine
+//! node as last child, the height of the container is half its size.
+fcarouge::tree<std::uint64_t> deep(std::int64_t size)
+{
+  fcarouge::tree_uint64_t bayeux_hazel;
+  if (size > 0) {
+    bayeux_hazel.emplace_front(0U);
+    auto spine = bayeux_hazel.begin();
+    for (std::int64_t i = 1; i + 1 < size; i += 2) {
+      bayeux_hazel.push(spine, i);
+      spine = bayeux_hazel.push(spine, i + 1);
+    }
+    if (size % 2 == 0) {
+      bayeux_hazel.push(spine, size - 1);
+    }
+  }
+
+  return bayeux_hazel;
+}
+
+//! @benchmark Measure the performance of the container's post-order traversal
+//! by iterator.
+void post_order_iterator(benchmark::State &state)
+{
+  auto bayeux_hazel{ deep(state.range(0)) };
+  assert(state.range(0) == bayeux_hazel.size() &&
+         "The size of the container does not meet expectations.");
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    auto start = std::chrono::high_resolution_clock::now();
+
+    std::uint64_t sum = 0;
+    for (auto position = fcarouge::post_order_begin(bayeux_hazel);
+         position != fcarouge::post_order_end(bayeux_hazel); ++position) {
+      sum += *position;
+    }
+    benchmark::DoNotOptimize(sum);
+
+    auto end = std::chrono::high_resolution_clock::now();
+    state.SetIterationTime(
+        std::chrono::duration_cast<std::chrono::duration<double>>(end - start)
+            .count());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+//! @benchmark Measure the performance of the container's post-order traversal
+//! by a recursive lambda for reference.
+void post_order_recursive(benchmark::State &state)
+{
+  auto bayeux_hazel{ deep(state.range(0)) };
+  assert(state.range(0) == bayeux_hazel.size() &&
+         "The size of the container does not meet expectations.");
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    auto start = std::chrono::high_resolution_clock::now();
+
+    std::uint64_t sum = 0;
+    const auto visit = [&sum](const auto &self, const auto *node) -> void {
+      for (const auto *child = node->first_child; child;
+           child = child->right_sibling) {
+        self(self, child);
+      }
+      sum += node->data;
+    };
+    if (const auto *root = bayeux_hazel.begin().node) {
+      visit(visit, root);
+    }
+    benchmark::DoNotOptimize(sum);
+
+    auto end = std::chrono::high_resolution_clock::now();
+    state.SetIterationTime(
+        std::chrono::duration_cast<std::chrono::duration<double>>(end - start)
+            .count());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(post_order_iterator)
+    ->Name("post_order_iterator")
+    ->Unit(benchmark::kNanosecond)
+    ->ComputeStatistics("min",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::min_element(std::begin(v), std::end(v)));
+                        })
+    ->ComputeStatistics("max",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::max_element(std::begin(v), std::end(v)));
+                        })
+    ->Arg(0)
+    ->UseManualTime()
+    ->Complexity(benchmark::oAuto)
+    ->DisplayAggregatesOnly(true)
+    ->RangeMultiplier(2)
+    ->Repetitions(10)
+    ->Range(1, 1 << 16);
+
+// The recursion depth is half the size of the container, the range is bounded
+// to remain within the default stack size.
+BENCHMARK(post_order_recursive)
+    ->Name("post_order_recursive")
+    ->Unit(benchmark::kNanosecond)
+    ->ComputeStatistics("min",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::min_element(std::begin(v), std::end(v)));
+                        })
+    ->ComputeStatistics("max",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::max_element(std::begin(v), std::end(v)));
+                        })
+    ->Arg(0)
+    ->UseManualTime()
+    ->Complexity(benchmark::oAuto)
+    ->DisplayAggregatesOnly(true)
+    ->RangeMultiplier(2)
+    ->Repetitions(10)
+    ->Range(1, 1 << 16);
+
+} // namespace
@@ -0,0 +1,253 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_iterator.hpp"
+// fcarouge::depth_first_pre_order_prefetch_iterator
+
+#include <benchmark/benchmark.h>
+// BENCHMARK benchmark::ClobberMemory benchmark::DoNotOptimize
+// benchmark::kNanosecond benchmark::State
+
+#include <cassert>
+// assert
+
+#include <chrono>
+// std::chrono::duration_cast std::chrono::high_resolution_clock
+// benchmark::oAuto
+
+#include <cstdint>
+// std::uint64_t
+
+#include <random>
+// std::mt19937_64 std::uniform_int_distribution
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @brief Builds a container of the given size by random emplacement.
+//!
+//! @details Every element is emplaced before an element chosen at random
+//! among the elements already in the container, as its new left sibling or as
+//! the new root. The allocation order of the nodes is unrelated to their
+//! pre-order, scattering the traversal in memory. The container is wide and
+//! shallow.
+fcarouge::tree<std::uint64_t> emplaced(std::int64_t size)
+{
+  fcarouge::tree<std::uint64_t> jumieges_poplar;
+  std::vector<fcarouge::tree<std::uint64_t>::iterator> positions;
+  std::mt19937_64 generator{ 42 };
+  for (std::int64_t i = 0; i < size; ++i) {
+    if (positions.empty()) {
+      positions.push_back(jumieges_poplar.emplace(jumieges_poplar.end(), 0U));
+    } else {
+      std::uniform_int_distribution<std::size_t> distribution{
+        0, positions.size() - 1
+      };
+      positions.push_back(jumieges_poplar.emplace(
+          positions[distribution(generator)], static_cast<std::uint64_t>(i)));
+    }
+  }
+
+  return jumieges_poplar;
+}
+
+//! @brief Builds a container of the given size by random pushes.
+//!
+//! @details Every element is pushed as the last child of an element chosen at
+//! random among the elements already in the container. The allocation order
+//! of the nodes is unrelated to their pre-order, scattering the traversal in
+//! memory. The container is a random recursive tree of logarithmic height.
+fcarouge::tree<std::uint64_t> pushed(std::int64_t size)
+{
+  fcarouge::tree<std::uint64_t> jumieges_poplar;
+  std::vector<fcarouge::tree<std::uint64_t>::iterator> positions;
+  std::mt19937_64 generator{ 42 };
+  for (std::int64_t i = 0; i < size; ++i) {
+    if (positions.empty()) {
+      positions.push_back(jumieges_poplar.emplace(jumieges_poplar.end(), 0U));
+    } else {
+      std::uniform_int_distribution<std::size_t> distribution{
+        0, positions.size() - 1
+      };
+      positions.push_back(jumieges_poplar.push(
+          positions[distribution(generator)], static_cast<std::uint64_t>(i)));
+    }
+  }
+
+  return jumieges_poplar;
+}
+
+//! @benchmark Measure the performance of the container's pre-order traversal
+//! by the container iterator.
+template <fcarouge::tree<std::uint64_t> (*Build)(std::int64_t)>
+void pre_order_iterator(benchmark::State &state)
+{
+  auto jumieges_poplar{ Build(state.range(0)) };
+  assert(state.range(0) == jumieges_poplar.size() &&
+         "The size of the container does not meet expectations.");
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    auto start = std::chrono::high_resolution_clock::now();
+
+    std::uint64_t sum = 0;
+    for (auto position = jumieges_poplar.begin();
+         position != jumieges_poplar.end(); ++position) {
+      sum += *position;
+    }
+    benchmark::DoNotOptimize(sum);
+
+    auto end = std::chrono::high_resolution_clock::now();
+    state.SetIterationTime(
+        std::chrono::duration_cast<std::chrono::duration<double>>(end - start)
+            .count());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+//! @benchmark Measure the performance of the container's pre-order traversal
+//! by the prefetching iterator.
+template <fcarouge::tree<std::uint64_t> (*Build)(std::int64_t)>
+void pre_order_prefetch_iterator(benchmark::State &state)
+{
+  auto jumieges_poplar{ Build(state.range(0)) };
+  assert(state.range(0) == jumieges_poplar.size() &&
+         "The size of the container does not meet expectations.");
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    auto start = std::chrono::high_resolution_clock::now();
+
+    std::uint64_t sum = 0;
+    fcarouge::depth_first_pre_order_prefetch_iterator<std::uint64_t> position =
+        jumieges_poplar.begin();
+    const fcarouge::depth_first_pre_order_prefetch_iterator<std::uint64_t>
+        end_position = jumieges_poplar.end();
+    for (; position != end_position; ++position) {
+      sum += *position;
+    }
+    benchmark::DoNotOptimize(sum);
+
+    auto end = std::chrono::high_resolution_clock::now();
+    state.SetIterationTime(
+        std::chrono::duration_cast<std::chrono::duration<double>>(end - start)
+            .count());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(pre_order_iterator<emplaced>)
+    ->Name("pre_order_iterator_emplaced")
+    ->Unit(benchmark::kNanosecond)
+    ->ComputeStatistics("min",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::min_element(std::begin(v), std::end(v)));
+                        })
+    ->ComputeStatistics("max",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::max_element(std::begin(v), std::end(v)));
+                        })
+    ->Arg(0)
+    ->UseManualTime()
+    ->Complexity(benchmark::oAuto)
+    ->DisplayAggregatesOnly(true)
+    ->RangeMultiplier(2)
+    ->Repetitions(10)
+    ->Range(1, 1 << 20);
+
+BENCHMARK(pre_order_prefetch_iterator<emplaced>)
+    ->Name("pre_order_prefetch_iterator_emplaced")
+    ->Unit(benchmark::kNanosecond)
+    ->ComputeStatistics("min",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::min_element(std::begin(v), std::end(v)));
+                        })
+    ->ComputeStatistics("max",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::max_element(std::begin(v), std::end(v)));
+                        })
+    ->Arg(0)
+    ->UseManualTime()
+    ->Complexity(benchmark::oAuto)
+    ->DisplayAggregatesOnly(true)
+    ->RangeMultiplier(2)
+    ->Repetitions(10)
+    ->Range(1, 1 << 20);
+
+BENCHMARK(pre_order_iterator<pushed>)
+    ->Name("pre_order_iterator_pushed")
+    ->Unit(benchmark::kNanosecond)
+    ->ComputeStatistics("min",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::min_element(std::begin(v), std::end(v)));
+                        })
+    ->ComputeStatistics("max",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::max_element(std::begin(v), std::end(v)));
+                        })
+    ->Arg(0)
+    ->UseManualTime()
+    ->Complexity(benchmark::oAuto)
+    ->DisplayAggregatesOnly(true)
+    ->RangeMultiplier(2)
+    ->Repetitions(10)
+    ->Range(1, 1 << 20);
+
+BENCHMARK(pre_order_prefetch_iterator<pushed>)
+    ->Name("pre_order_prefetch_iterator_pushed")
+    ->Unit(benchmark::kNanosecond)
+    ->ComputeStatistics("min",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::min_element(std::begin(v), std::end(v)));
+                        })
+    ->ComputeStatistics("max",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::max_element(std::begin(v), std::end(v)));
+                        })
+    ->Arg(0)
+    ->UseManualTime()
+    ->Complexity(benchmark::oAuto)
+    ->DisplayAggregatesOnly(true)
+    ->RangeMultiplier(2)
+    ->Repetitions(10)
+    ->Range(1, 1 << 20);
+
+} // namespace
@@ -0,0 +1,200 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_algorithm.hpp"
+// fcarouge::find_many
+
+#include <benchmark/benchmark.h>
+// BENCHMARK benchmark::ClobberMemory benchmark::DoNotOptimize
+// benchmark::kNanosecond benchmark::State
+
+#include <algorithm>
+// std::find
+
+#include <chrono>
+// std::chrono::duration_cast std::chrono::high_resolution_clock
+// benchmark::oAuto
+
+#include <cstdint>
+// std::int64_t std::uint64_t
+
+#include <random>
+// std::mt19937_64 std::uniform_int_distribution
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @brief The number of elements of every small container.
+constexpr std::int64_t elements = 32;
+
+//! @brief The forest of many small containers and their searched values.
+struct forest {
+  std::vector<fcarouge::tree<std::uint64_t>> trees;
+  std::vector<fcarouge::tree<std::uint64_t>::const_iterator> positions;
+  std::vector<std::uint64_t> values;
+};
+
+//! @brief Builds the given number of small containers and one lookup each.
+//!
+//! @details The elements are pushed in turn into random containers, under
+//! random parents, scattering the nodes of every container in memory. Every
+//! lookup searches a random value of its container.
+forest scattered(std::int64_t size)
+{
+  forest carouges;
+  carouges.trees.resize(static_cast<std::size_t>(size));
+  std::vector<std::vector<fcarouge::tree<std::uint64_t>::iterator>> positions(
+      carouges.trees.size());
+  std::mt19937_64 generator{ 42 };
+  for (std::int64_t i = 0; i < size * elements; ++i) {
+    std::uniform_int_distribution<std::size_t> tree_distribution{
+      0, carouges.trees.size() - 1
+    };
+    const std::size_t index = tree_distribution(generator);
+    auto &eawy_beech = carouges.trees[index];
+    auto &nodes = positions[index];
+    if (nodes.empty()) {
+      nodes.push_back(eawy_beech.emplace(eawy_beech.end(), i));
+    } else {
+      std::uniform_int_distribution<std::size_t> node_distribution{
+        0, nodes.size() - 1
+      };
+      nodes.push_back(eawy_beech.push(nodes[node_distribution(generator)],
+                                      static_cast<std::uint64_t>(i)));
+    }
+  }
+  for (std::size_t i = 0; i < carouges.trees.size(); ++i) {
+    carouges.positions.push_back(carouges.trees[i].cbegin());
+    if (positions[i].empty()) {
+      carouges.values.push_back(0U);
+    } else {
+      std::uniform_int_distribution<std::size_t> node_distribution{
+        0, positions[i].size() - 1
+      };
+      carouges.values.push_back(*positions[i][node_distribution(generator)]);
+    }
+  }
+
+  return carouges;
+}
+
+//! @benchmark Measure the performance of the lookups, one after the other.
+void find_sequential(benchmark::State &state)
+{
+  const auto carouges{ scattered(state.range(0)) };
+  std::vector<fcarouge::tree<std::uint64_t>::const_iterator> results(
+      carouges.positions.size());
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (std::size_t i = 0; i < carouges.positions.size(); ++i) {
+      results[i] = std::find(carouges.positions[i], carouges.trees[i].cend(),
+                             carouges.values[i]);
+    }
+    benchmark::DoNotOptimize(results.data());
+
+    auto end = std::chrono::high_resolution_clock::now();
+    state.SetIterationTime(
+        std::chrono::duration_cast<std::chrono::duration<double>>(end - start)
+            .count());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+//! @benchmark Measure the performance of the interleaved lookups.
+void find_many(benchmark::State &state)
+{
+  const auto carouges{ scattered(state.range(0)) };
+  std::vector<fcarouge::tree<std::uint64_t>::const_iterator> results(
+      carouges.positions.size());
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    auto start = std::chrono::high_resolution_clock::now();
+
+    fcarouge::find_many(carouges.positions, carouges.values, results.begin());
+    benchmark::DoNotOptimize(results.data());
+
+    auto end = std::chrono::high_resolution_clock::now();
+    state.SetIterationTime(
+        std::chrono::duration_cast<std::chrono::duration<double>>(end - start)
+            .count());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(find_sequential)
+    ->Name("find_sequential")
+    ->Unit(benchmark::kNanosecond)
+    ->ComputeStatistics("min",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::min_element(std::begin(v), std::end(v)));
+                        })
+    ->ComputeStatistics("max",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::max_element(std::begin(v), std::end(v)));
+                        })
+    ->Arg(0)
+    ->UseManualTime()
+    ->Complexity(benchmark::oAuto)
+    ->DisplayAggregatesOnly(true)
+    ->RangeMultiplier(2)
+    ->Repetitions(10)
+    ->Range(1, 1 << 15);
+
+BENCHMARK(find_many)
+    ->Name("find_many")
+    ->Unit(benchmark::kNanosecond)
+    ->ComputeStatistics("min",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::min_element(std::begin(v), std::end(v)));
+                        })
+    ->ComputeStatistics("max",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::max_element(std::begin(v), std::end(v)));
+                        })
+    ->Arg(0)
+    ->UseManualTime()
+    ->Complexity(benchmark::oAuto)
+    ->DisplayAggregatesOnly(true)
+    ->RangeMultiplier(2)
+    ->Repetitions(10)
+    ->Range(1, 1 << 15);
+
+} // namespace
@@ -0,0 +1,176 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_algorithm.hpp"
+// fcarouge::for_each
+
+#include "fcarouge/tree_execution.hpp"
+// fcarouge::par fcarouge::seq
+
+#include <benchmark/benchmark.h>
+// BENCHMARK benchmark::ClobberMemory benchmark::DoNotOptimize
+// benchmark::kNanosecond benchmark::State
+
+#include <cassert>
+// assert
+
+#include <chrono>
+// std::chrono::duration_cast std::chrono::high_resolution_clock
+// benchmark::oAuto
+
+#include <cmath>
+// std::sqrt
+
+#include <cstdint>
+// std::int64_t std::uint64_t
+
+#include <random>
+// std::mt19937_64 std::uniform_int_distribution
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @brief Builds a bushy container of the given size by random pushes.
+fcarouge::tree<double> bushy(std::int64_t size)
+{
+  fcarouge::tree<double> belleme_oak;
+  std::vector<fcarouge::tree<double>::iterator> positions;
+  std::mt19937_64 generator{ 42 };
+  for (std::int64_t i = 0; i < size; ++i) {
+    if (positions.empty()) {
+      positions.push_back(belleme_oak.emplace(belleme_oak.end(), 0.));
+    } else {
+      std::uniform_int_distribution<std::size_t> distribution{
+        0, positions.size() - 1
+      };
+      positions.push_back(belleme_oak.push(positions[distribution(generator)],
+                                           static_cast<double>(i)));
+    }
+  }
+
+  return belleme_oak;
+}
+
+//! @brief Applies some computation to an element.
+void work(double &value)
+{
+  for (int i = 0; i < 16; ++i) {
+    value = std::sqrt(value + 1.);
+  }
+}
+
+//! @benchmark Measure the performance of the sequenced traversal.
+void for_each_sequenced(benchmark::State &state)
+{
+  auto belleme_oak{ bushy(state.range(0)) };
+  assert(state.range(0) == belleme_oak.size() &&
+         "The size of the container does not meet expectations.");
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    auto start = std::chrono::high_resolution_clock::now();
+
+    fcarouge::for_each(fcarouge::seq, belleme_oak, work);
+
+    auto end = std::chrono::high_resolution_clock::now();
+    state.SetIterationTime(
+        std::chrono::duration_cast<std::chrono::duration<double>>(end - start)
+            .count());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+//! @benchmark Measure the performance of the parallel traversal.
+void for_each_parallel(benchmark::State &state)
+{
+  auto belleme_oak{ bushy(state.range(0)) };
+  assert(state.range(0) == belleme_oak.size() &&
+         "The size of the container does not meet expectations.");
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    auto start = std::chrono::high_resolution_clock::now();
+
+    fcarouge::for_each(fcarouge::par, belleme_oak, work);
+
+    auto end = std::chrono::high_resolution_clock::now();
+    state.SetIterationTime(
+        std::chrono::duration_cast<std::chrono::duration<double>>(end - start)
+            .count());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(for_each_sequenced)
+    ->Name("for_each_sequenced")
+    ->Unit(benchmark::kNanosecond)
+    ->ComputeStatistics("min",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::min_element(std::begin(v), std::end(v)));
+                        })
+    ->ComputeStatistics("max",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::max_element(std::begin(v), std::end(v)));
+                        })
+    ->Arg(0)
+    ->UseManualTime()
+    ->Complexity(benchmark::oAuto)
+    ->DisplayAggregatesOnly(true)
+    ->RangeMultiplier(2)
+    ->Repetitions(10)
+    ->Range(1, 1 << 20);
+
+BENCHMARK(for_each_parallel)
+    ->Name("for_each_parallel")
+    ->Unit(benchmark::kNanosecond)
+    ->ComputeStatistics("min",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::min_element(std::begin(v), std::end(v)));
+                        })
+    ->ComputeStatistics("max",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::max_element(std::begin(v), std::end(v)));
+                        })
+    ->Arg(0)
+    ->UseManualTime()
+    ->Complexity(benchmark::oAuto)
+    ->DisplayAggregatesOnly(true)
+    ->RangeMultiplier(2)
+    ->Repetitions(10)
+    ->Range(1, 1 << 20);
+
+} // namespace
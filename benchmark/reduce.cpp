@@ -0,0 +1,215 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_algorithm.hpp"
+// fcarouge::reduce
+
+#include "fcarouge/tree_execution.hpp"
+// fcarouge::par fcarouge::seq
+
+#include <benchmark/benchmark.h>
+// BENCHMARK benchmark::ClobberMemory benchmark::DoNotOptimize
+// benchmark::kNanosecond benchmark::State
+
+#include <cassert>
+// assert
+
+#include <chrono>
+// std::chrono::duration_cast std::chrono::high_resolution_clock
+// benchmark::oAuto
+
+#include <cstdint>
+// std::int64_t std::uint64_t
+
+#include <numeric>
+// std::accumulate
+
+#include <random>
+// std::mt19937_64 std::uniform_int_distribution
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @brief Builds a bushy container of the given size by random pushes.
+fcarouge::tree<std::uint64_t> bushy(std::int64_t size)
+{
+  fcarouge::tree<std::uint64_t> cerisy_beech;
+  std::vector<fcarouge::tree<std::uint64_t>::iterator> positions;
+  std::mt19937_64 generator{ 42 };
+  for (std::int64_t i = 0; i < size; ++i) {
+    if (positions.empty()) {
+      positions.push_back(cerisy_beech.emplace(cerisy_beech.end(), 0U));
+    } else {
+      std::uniform_int_distribution<std::size_t> distribution{
+        0, positions.size() - 1
+      };
+      positions.push_back(cerisy_beech.push(positions[distribution(generator)],
+                                            static_cast<std::uint64_t>(i)));
+    }
+  }
+
+  return cerisy_beech;
+}
+
+//! @benchmark Measure the performance of the sum of the elements by
+//! `std::accumulate` over the container iterators for reference.
+void accumulate(benchmark::State &state)
+{
+  const auto cerisy_beech{ bushy(state.range(0)) };
+  assert(state.range(0) == cerisy_beech.size() &&
+         "The size of the container does not meet expectations.");
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    auto start = std::chrono::high_resolution_clock::now();
+
+    benchmark::DoNotOptimize(
+        std::accumulate(cerisy_beech.begin(), cerisy_beech.end(),
+                        std::uint64_t{ 0 }));
+
+    auto end = std::chrono::high_resolution_clock::now();
+    state.SetIterationTime(
+        std::chrono::duration_cast<std::chrono::duration<double>>(end - start)
+            .count());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+//! @benchmark Measure the performance of the sequenced sum of the elements.
+void reduce_sequenced(benchmark::State &state)
+{
+  const auto cerisy_beech{ bushy(state.range(0)) };
+  assert(state.range(0) == cerisy_beech.size() &&
+         "The size of the container does not meet expectations.");
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    auto start = std::chrono::high_resolution_clock::now();
+
+    benchmark::DoNotOptimize(
+        fcarouge::reduce(fcarouge::seq, cerisy_beech, std::uint64_t{ 0 }));
+
+    auto end = std::chrono::high_resolution_clock::now();
+    state.SetIterationTime(
+        std::chrono::duration_cast<std::chrono::duration<double>>(end - start)
+            .count());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+//! @benchmark Measure the performance of the parallel sum of the elements.
+void reduce_parallel(benchmark::State &state)
+{
+  const auto cerisy_beech{ bushy(state.range(0)) };
+  assert(state.range(0) == cerisy_beech.size() &&
+         "The size of the container does not meet expectations.");
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    auto start = std::chrono::high_resolution_clock::now();
+
+    benchmark::DoNotOptimize(
+        fcarouge::reduce(fcarouge::par, cerisy_beech, std::uint64_t{ 0 }));
+
+    auto end = std::chrono::high_resolution_clock::now();
+    state.SetIterationTime(
+        std::chrono::duration_cast<std::chrono::duration<double>>(end - start)
+            .count());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(accumulate)
+    ->Name("accumulate")
+    ->Unit(benchmark::kNanosecond)
+    ->ComputeStatistics("min",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::min_element(std::begin(v), std::end(v)));
+                        })
+    ->ComputeStatistics("max",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::max_element(std::begin(v), std::end(v)));
+                        })
+    ->Arg(0)
+    ->UseManualTime()
+    ->Complexity(benchmark::oAuto)
+    ->DisplayAggregatesOnly(true)
+    ->RangeMultiplier(2)
+    ->Repetitions(10)
+    ->Range(1, 1 << 20);
+
+BENCHMARK(reduce_sequenced)
+    ->Name("reduce_sequenced")
+    ->Unit(benchmark::kNanosecond)
+    ->ComputeStatistics("min",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::min_element(std::begin(v), std::end(v)));
+                        })
+    ->ComputeStatistics("max",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::max_element(std::begin(v), std::end(v)));
+                        })
+    ->Arg(0)
+    ->UseManualTime()
+    ->Complexity(benchmark::oAuto)
+    ->DisplayAggregatesOnly(true)
+    ->RangeMultiplier(2)
+    ->Repetitions(10)
+    ->Range(1, 1 << 20);
+
+BENCHMARK(reduce_parallel)
+    ->Name("reduce_parallel")
+    ->Unit(benchmark::kNanosecond)
+    ->ComputeStatistics("min",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::min_element(std::begin(v), std::end(v)));
+                        })
+    ->ComputeStatistics("max",
+                        [](const std::vector<double> &v) -> double {
+                          return *(
+                              std::max_element(std::begin(v), std::end(v)));
+                        })
+    ->Arg(0)
+    ->UseManualTime()
+    ->Complexity(benchmark::oAuto)
+    ->DisplayAggregatesOnly(true)
+    ->RangeMultiplier(2)
+    ->Repetitions(10)
+    ->Range(1, 1 << 20);
+
+} // namespace
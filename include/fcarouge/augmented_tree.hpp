@@ -0,0 +1,485 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+//! @file
+//! @brief Augmented tree container definition header.
+//!
+//! @details The header contains the tree container variant maintaining an
+//! aggregate of every subtree.
+
+#ifndef FCAROUGE_AUGMENTED_TREE_HPP
+#define FCAROUGE_AUGMENTED_TREE_HPP
+
+#include <functional>
+// std::invoke
+
+#include <memory>
+// std::allocator_traits
+
+#include <type_traits>
+// std::invoke_result_t std::is_same_v std::remove_cvref_t
+
+#include <utility>
+// std::as_const std::forward std::move
+
+#include "tree.hpp"
+
+#include "tree_fwd.hpp"
+
+//! @namespace fcarouge Francois Carouge's projects namespace. Lowers the name
+//! conflict probability in large projects. Use using-declarations or
+//! namespace-alias-definition per your project guidelines.
+namespace fcarouge
+{
+//! @brief A tree data structure maintaining the aggregates of its subtrees.
+//!
+//! @details The `fcarouge::augmented_tree` type is a tree container whose
+//! elements hold the aggregate of the weights of their subtree. The weight of
+//! an element is the projection of its value. The weights are aggregated by an
+//! associative operation in pre-order: the weight of the element followed by
+//! the aggregates of its children. The aggregates are updated along the
+//! ancestor path of every modification of the topology and of the values,
+//! reading the aggregate of a subtree is constant. The values are modified
+//! through the checked `modify` accessor only, the iterators are constant.
+//!
+//! @tparam Type The type template parameter of the contained data elements.
+//! @tparam Allocator The allocator type template parameter of the contained
+//! data elements, rebound for the elements and their aggregates.
+//! @tparam Operation The type template parameter of the associative binary
+//! operation aggregating the weights.
+//! @tparam Projection The type template parameter of the projection of the
+//! element values to their weights.
+template <typename Type, typename Allocator, typename Operation,
+          typename Projection>
+class augmented_tree
+{
+  public:
+  static_assert(std::is_same_v<Type, typename Allocator::value_type>,
+                "The container's element value type and its allocator's value "
+                "type must match per N4861 22.2.1 "
+                "[container.requirements.general]/16 allocator_type.");
+
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The type of the contained data elements.
+  using value_type = Type;
+
+  //! @brief The type of the weights of the elements and of their aggregates.
+  using aggregate_type = std::remove_cvref_t<
+      std::invoke_result_t<Projection &, const value_type &>>;
+
+  //! @brief The type of the allocator of the contained data elements.
+  using allocator_type = Allocator;
+
+  //! @brief The augmented element type pairing a value with the aggregate of
+  //! its subtree.
+  struct element_type {
+    //! @name Public Member Variables
+    //! @{
+
+    //! @brief The value of the element.
+    value_type value;
+
+    //! @brief The aggregate of the weights of the subtree of the element.
+    aggregate_type aggregate;
+
+    //! @}
+  };
+
+  //! @brief The type of the underlying container of the augmented elements.
+  using container_type = tree<
+      element_type,
+      typename std::allocator_traits<Allocator>::template rebind_alloc<
+          element_type>>;
+
+  //! @brief The unsigned integer type to represent element counts.
+  using size_type = typename container_type::size_type;
+
+  //! @brief Signed integer type to represent element distances.
+  using difference_type = typename container_type::difference_type;
+
+  //! @brief The constant reference type of the augmented elements.
+  using const_reference = typename container_type::const_reference;
+
+  //! @brief The constant type to identify and traverse the augmented elements
+  //! of the container.
+  using const_iterator = typename container_type::const_iterator;
+
+  //! @brief The type to identify and traverse the augmented elements of the
+  //! container. The augmented elements are modified through the container.
+  using iterator = const_iterator;
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief Constructs an empty container.
+  //!
+  //! @param operation The associative binary operation aggregating the weights.
+  //! @param projection The projection of the element values to their weights.
+  //! @param allocator The allocator to use for all memory allocations of this
+  //! container.
+  //!
+  //! @complexity Constant.
+  explicit augmented_tree(Operation operation = Operation{},
+                          Projection projection = Projection{},
+                          const Allocator &allocator = Allocator{})
+          : container{ typename container_type::allocator_type{ allocator } },
+            operation{ std::move(operation) },
+            projection{ std::move(projection) }
+  {
+  }
+
+  //! @brief Returns the allocator associated with the container.
+  //!
+  //! @return The associated allocator.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] allocator_type get_allocator() const noexcept
+  {
+    return allocator_type{ container.get_allocator() };
+  }
+
+  //! @}
+
+  //! @name Public Element Access Member Functions
+  //! @{
+
+  //! @brief Returns the aggregate of the subtree of an element.
+  //!
+  //! @details The behavior is undefined if the iterator is not a
+  //! dereferenceable iterator of the container.
+  //!
+  //! @param position The iterator to the root element of the subtree.
+  //!
+  //! @return The constant reference to the aggregate of the weights of the
+  //! subtree.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] const aggregate_type &
+  aggregate(const_iterator position) const noexcept
+  {
+    return position->aggregate;
+  }
+
+  //! @}
+
+  //! @name Public Iterators Member Functions
+  //! @{
+
+  //! @brief Returns an iterator to the first element of the container.
+  //!
+  //! @return Iterator to the first element.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] const_iterator begin() const noexcept
+  {
+    return container.begin();
+  }
+
+  //! @brief Returns an iterator to the first element of the container.
+  //!
+  //! @return Iterator to the first element.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] const_iterator cbegin() const noexcept
+  {
+    return container.cbegin();
+  }
+
+  //! @brief Returns an iterator to the element following the last element of
+  //! the container.
+  //!
+  //! @return Iterator to the element following the last element.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] const_iterator end() const noexcept
+  {
+    return container.end();
+  }
+
+  //! @brief Returns an iterator to the element following the last element of
+  //! the container.
+  //!
+  //! @return Iterator to the element following the last element.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] const_iterator cend() const noexcept
+  {
+    return container.cend();
+  }
+
+  //! @}
+
+  //! @name Public Capacity Member Functions
+  //! @{
+
+  //! @brief Checks if the container has no elements.
+  //!
+  //! @return `true` if the container is empty, `false` otherwise.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] bool empty() const noexcept
+  {
+    return container.empty();
+  }
+
+  //! @brief Returns the number of elements in the container.
+  //!
+  //! @return The number of elements in the container.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] size_type size() const noexcept
+  {
+    return container.size();
+  }
+
+  //! @}
+
+  //! @name Public Modifier Member Functions
+  //! @{
+
+  //! @brief Erases all elements from the container.
+  //!
+  //! @complexity Linear in size of this container.
+  void clear() noexcept
+  {
+    container.clear();
+  }
+
+  //! @brief Inserts a constructed in-place element into the container before
+  //! the `position` iterator as the new left sibling.
+  //!
+  //! @details Follows the container's `emplace` modifier semantics and updates
+  //! the aggregates of the new element and of its ancestors.
+  //!
+  //! @tparam Arguments The arguments type template parameter pack to forward to
+  //! the constructor of the element value.
+  //!
+  //! @param position The iterator before which the new element will be
+  //! constructed. The iterator may be the beginning `begin()` or ending
+  //! `end()` iterator.
+  //! @param arguments The arguments to forward to the constructor of the
+  //! element value.
+  //!
+  //! @return The iterator pointing to the inserted element.
+  //!
+  //! @complexity Linear in the number of children of the new element and of
+  //! its ancestors.
+  template <typename... Arguments>
+  const_iterator emplace(const_iterator position, Arguments &&... arguments)
+  {
+    element_type element{ augment(std::forward<Arguments>(arguments)...) };
+    const_iterator inserted{
+      container.emplace(position, std::move(element)).node
+    };
+    update(inserted.node);
+
+    return inserted;
+  }
+
+  //! @brief Inserts a constructed in-place element into the container before
+  //! the root beginning as the new root.
+  //!
+  //! @tparam Arguments The arguments type template parameter pack to forward to
+  //! the constructor of the element value.
+  //!
+  //! @param arguments The arguments to forward to the constructor of the
+  //! element value.
+  //!
+  //! @return The iterator pointing to the inserted element.
+  //!
+  //! @complexity Linear in the number of children of the new root.
+  template <typename... Arguments>
+  const_iterator emplace_front(Arguments &&... arguments)
+  {
+    container.emplace_front(augment(std::forward<Arguments>(arguments)...));
+    update(container.begin().node);
+
+    return container.cbegin();
+  }
+
+  //! @brief Inserts a copied element into the container after the last child
+  //! of the `position` iterator as the new last child.
+  //!
+  //! @details Follows the container's `push` modifier semantics and updates
+  //! the aggregates of the ancestors of the new element.
+  //!
+  //! @param position The parent element iterator for which the element will be
+  //! inserted as the last child.
+  //! @param value The value of the element to insert.
+  //!
+  //! @return The iterator pointing to the inserted element.
+  //!
+  //! @complexity Linear in the number of children of the ancestors of the new
+  //! element.
+  const_iterator push(const_iterator position, const value_type &value)
+  {
+    const_iterator inserted{ container.push(position, augment(value)).node };
+    update(inserted.node->parent);
+
+    return inserted;
+  }
+
+  //! @brief Inserts a moved element into the container after the last child
+  //! of the `position` iterator as the new last child.
+  //!
+  //! @details Follows the container's `push` modifier semantics and updates
+  //! the aggregates of the ancestors of the new element.
+  //!
+  //! @param position The parent element iterator for which the element will be
+  //! inserted as the last child.
+  //! @param value The value of the element to insert.
+  //!
+  //! @return The iterator pointing to the inserted element.
+  //!
+  //! @complexity Linear in the number of children of the ancestors of the new
+  //! element.
+  const_iterator push(const_iterator position, value_type &&value)
+  {
+    const_iterator inserted{
+      container.push(position, augment(std::move(value))).node
+    };
+    update(inserted.node->parent);
+
+    return inserted;
+  }
+
+  //! @brief Removes the specified element including its sub-tree.
+  //!
+  //! @details Follows the container's `erase` modifier semantics and updates
+  //! the aggregates of the ancestors of the removed element.
+  //!
+  //! @param position The iterator to the element to remove with its subtree.
+  //!
+  //! @return Iterator following the last removed element.
+  //!
+  //! @complexity Linear in the size of the removed subtree and in the number of
+  //! children of the ancestors of the removed element.
+  const_iterator erase(const_iterator position)
+  {
+    auto *parent = position.node->parent;
+    const_iterator next{ container.erase(position).node };
+    update(parent);
+
+    return next;
+  }
+
+  //! @brief Modifies the value of an element.
+  //!
+  //! @details The checked accessor to the values of the elements. The function
+  //! is invoked with the reference to the value of the element, then the
+  //! aggregates of the element and of its ancestors are updated. The behavior
+  //! is undefined if the iterator is not a dereferenceable iterator of the
+  //! container.
+  //!
+  //! @tparam Function The type template parameter of the modifying function.
+  //!
+  //! @param position The iterator to the element to modify.
+  //! @param function The function invoked with the reference to the value.
+  //!
+  //! @complexity Linear in the number of children of the element and of its
+  //! ancestors.
+  template <typename Function>
+  void modify(const_iterator position, Function &&function)
+  {
+    std::invoke(std::forward<Function>(function), position.node->data.value);
+    update(position.node);
+  }
+
+  //! @}
+
+  private:
+  //! @name Private Member Functions
+  //! @{
+
+  //! @brief Constructs an augmented element from a value.
+  //!
+  //! @details The aggregate of the element is its weight, updated once the
+  //! element is inserted.
+  //!
+  //! @tparam Arguments The arguments type template parameter pack to forward to
+  //! the constructor of the element value.
+  //!
+  //! @param arguments The arguments to forward to the constructor of the
+  //! element value.
+  //!
+  //! @return The augmented element.
+  template <typename... Arguments>
+  element_type augment(Arguments &&... arguments)
+  {
+    value_type value(std::forward<Arguments>(arguments)...);
+    aggregate_type weight{ std::invoke(projection, std::as_const(value)) };
+
+    return { std::move(value), std::move(weight) };
+  }
+
+  //! @brief Updates the aggregates of a node and of its ancestors.
+  //!
+  //! @details The aggregate of a node is recomputed from its weight and the
+  //! aggregates of its children, from the node up to the root.
+  //!
+  //! @param node The deepest node to update, if any.
+  //!
+  //! @complexity Linear in the number of children of the node and of its
+  //! ancestors.
+  template <typename Node> void update(Node *node)
+  {
+    for (; node; node = node->parent) {
+      aggregate_type aggregate{ std::invoke(
+          projection, std::as_const(node->data.value)) };
+      for (const Node *child = node->first_child; child;
+           child = child->right_sibling) {
+        aggregate =
+            std::invoke(operation, std::move(aggregate), child->data.aggregate);
+      }
+      node->data.aggregate = std::move(aggregate);
+    }
+  }
+
+  //! @}
+
+  //! @name Private Member Variables
+  //! @{
+
+  //! @brief The underlying container of the augmented elements.
+  container_type container;
+
+  //! @brief The associative binary operation aggregating the weights.
+  [[no_unique_address]] Operation operation;
+
+  //! @brief The projection of the element values to their weights.
+  [[no_unique_address]] Projection projection;
+
+  //! @}
+};
+} // namespace fcarouge
+
+#endif // FCAROUGE_AUGMENTED_TREE_HPP
@@ -0,0 +1,1184 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+//! @file
+//! @brief Copy-on-write tree container definition header.
+//!
+//! @details The header contains the tree container variant sharing its
+//! reference-counted subtrees across copies.
+
+#ifndef FCAROUGE_COW_TREE_HPP
+#define FCAROUGE_COW_TREE_HPP
+
+#include <algorithm>
+// std::equal
+
+#include <atomic>
+// std::atomic std::memory_order_acq_rel std::memory_order_acquire
+// std::memory_order_relaxed
+
+#include <cstddef>
+// std::ptrdiff_t std::size_t
+
+#include <functional>
+// std::invoke
+
+#include <iterator>
+// std::forward_iterator_tag std::next
+
+#include <memory>
+// std::addressof std::allocator_traits std::pointer_traits
+
+#include <ostream>
+// std::basic_ostream
+
+#include <string>
+// std::basic_string
+
+#include <type_traits>
+// std::is_same_v
+
+#include <utility>
+// std::exchange std::forward std::move std::pair
+
+#include <vector>
+// std::vector
+
+#include "tree.hpp"
+
+#include "tree_fwd.hpp"
+
+//! @namespace fcarouge Francois Carouge's projects namespace. Lowers the name
+//! conflict probability in large projects. Use using-declarations or
+//! namespace-alias-definition per your project guidelines.
+namespace fcarouge
+{
+//! @brief A tree data structure sharing its subtrees across copies.
+//!
+//! @details The `fcarouge::cow_tree` type is a copy-on-write tree container.
+//! Its nodes are reference-counted and shared by the copies of the container:
+//! copying the container is constant. A modification clones the shared nodes
+//! on the path from the root to the modified node, the other subtrees remain
+//! shared. The values are modified through the checked `modify` accessor only,
+//! the iterators are constant. The iterators traverse the elements in
+//! depth-first pre-order, as the `fcarouge::tree` iterators do, and hold the
+//! path from the root to their element. The modifications invalidate the
+//! iterators of the modified container only. The copies of a container may be
+//! used and modified concurrently.
+//!
+//! @tparam Type The type template parameter of the contained data elements.
+//! @tparam Allocator The allocator type template parameter of the contained
+//! data elements, rebound for the nodes. The nodes are shared by the containers
+//! of equal allocators only.
+template <typename Type, typename Allocator> class cow_tree
+{
+  public:
+  static_assert(std::is_same_v<Type, typename Allocator::value_type>,
+                "The container's element value type and its allocator's value "
+                "type must match per N4861 22.2.1 "
+                "[container.requirements.general]/16 allocator_type.");
+
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The type of the contained data elements.
+  using value_type = Type;
+
+  //! @brief The type of the allocator of the contained data elements.
+  using allocator_type = Allocator;
+
+  //! @brief The unsigned integer type to represent element counts.
+  using size_type = std::size_t;
+
+  //! @brief Signed integer type to represent element distances.
+  using difference_type = std::ptrdiff_t;
+
+  //! @brief The reference type of the contained data elements.
+  using reference = value_type &;
+
+  //! @brief The constant reference type of the contained data elements.
+  using const_reference = const value_type &;
+
+  //! @brief The pointer type of the contained data elements.
+  using pointer = typename std::allocator_traits<Allocator>::pointer;
+
+  //! @brief The constant pointer type of the contained data elements.
+  using const_pointer =
+      typename std::allocator_traits<Allocator>::const_pointer;
+
+  //! @}
+
+  private:
+  //! @name Internal Implementation Types
+  //! @{
+
+  struct internal_node_type;
+
+  //! @brief The allocator type of the nodes.
+  using internal_node_allocator_type = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<internal_node_type>;
+
+  //! @brief The type of the children of a node.
+  using internal_children_type =
+      std::vector<internal_node_type *,
+                  typename std::allocator_traits<
+                      Allocator>::template rebind_alloc<internal_node_type *>>;
+
+  //! @brief The reference-counted node data structure type containing the
+  //! element data.
+  struct internal_node_type {
+    //! @name Public Member Functions
+    //! @{
+
+    //! @brief Constructs a sole referenced leaf node.
+    //!
+    //! @tparam Arguments The arguments type template parameter pack to forward
+    //! to the constructor of the element.
+    //!
+    //! @param allocator The allocator of the children.
+    //! @param arguments The arguments to forward to the constructor of the
+    //! element.
+    template <typename... Arguments>
+    explicit internal_node_type(
+        const typename internal_children_type::allocator_type &allocator,
+        Arguments &&... arguments)
+            : data(std::forward<Arguments>(arguments)...), children{ allocator }
+    {
+    }
+
+    //! @}
+
+    //! @name Public Member Variables
+    //! @{
+
+    //! @brief The element data of the node.
+    Type data;
+
+    //! @brief The children of the node, from left to right.
+    internal_children_type children;
+
+    //! @brief The number of nodes of the subtree of the node.
+    size_type count{ 1 };
+
+    //! @brief The number of the references to the node, from the containers
+    //! and the parent nodes.
+    std::atomic<size_type> references{ 1 };
+
+    //! @}
+  };
+
+  //! @brief The position of a node on the path from the root.
+  struct internal_step_type {
+    //! @name Public Member Variables
+    //! @{
+
+    //! @brief The node at this position of the path.
+    internal_node_type *node;
+
+    //! @brief The index of the node in the children of its parent.
+    size_type index;
+
+    //! @}
+  };
+
+  //! @brief The type of the path from the root to a node.
+  using internal_path_type =
+      std::vector<internal_step_type,
+                  typename std::allocator_traits<
+                      Allocator>::template rebind_alloc<internal_step_type>>;
+
+  //! @}
+
+  public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The constant type to traverse the elements of the container in
+  //! depth-first pre-order.
+  //!
+  //! @details The iterator holds the path from the root to its element.
+  class const_iterator
+  {
+    public:
+    //! @name Public Member Types
+    //! @{
+
+    //! @brief The type of the contained data elements.
+    using value_type = cow_tree::value_type;
+
+    //! @brief Signed integer type to represent element distances.
+    using difference_type = cow_tree::difference_type;
+
+    //! @brief The reference type of the contained data elements.
+    using reference = cow_tree::const_reference;
+
+    //! @brief The pointer type of the contained data elements.
+    using pointer = cow_tree::const_pointer;
+
+    //! @brief The LegacyForwardIterator requirements category of the iterator.
+    using iterator_category = std::forward_iterator_tag;
+
+    //! @brief The container type of the iterator.
+    using container_type = cow_tree;
+
+    //! @}
+
+    //! @name Public Observer Member Functions
+    //! @{
+
+    //! @brief Accesses the stored element data.
+    //!
+    //! @details The behavior is undefined if the iterator is invalid.
+    //!
+    //! @return Reference to the element if the iterator is dereferencable.
+    [[nodiscard]] reference operator*() const noexcept
+    {
+      return path.back().node->data;
+    }
+
+    //! @brief Points to the stored element.
+    //!
+    //! @details The behavior is undefined if the iterator is invalid.
+    //!
+    //! @return Pointer to the container's stored value iterator.
+    [[nodiscard]] pointer operator->() const noexcept
+    {
+      return std::pointer_traits<pointer>::pointer_to(path.back().node->data);
+    }
+
+    //! @}
+
+    //! @name Public Modifier Member Functions
+    //! @{
+
+    //! @brief Prefix increments the iterator.
+    //!
+    //! @details Moves to the first child of the element, if any, or to the
+    //! next sibling of the element or of its nearest ancestor.
+    //!
+    //! @return Reference to the next iterator.
+    //!
+    //! @complexity Constant amortized over a traversal.
+    const_iterator &operator++()
+    {
+      if (const internal_node_type *node = path.back().node;
+          !node->children.empty()) {
+        path.push_back({ node->children.front(), 0 });
+      } else {
+        skip();
+      }
+
+      return *this;
+    }
+
+    //! @brief Postfix increments the iterator.
+    //!
+    //! @return Next iterator.
+    //!
+    //! @complexity Linear in the depth of the element.
+    const_iterator operator++(int)
+    {
+      const_iterator temporary_iterator = *this;
+      ++*this;
+
+      return temporary_iterator;
+    }
+
+    //! @}
+
+    //! @name Public Comparison Function
+    //! @{
+
+    //! @brief Compares the iterators.
+    //!
+    //! @details Checks if the iterators point to the same element.
+    //!
+    //! @param other The iterator to evaluate.
+    //!
+    //! @return `true` if the iterators point to the same element, `false`
+    //! otherwise.
+    //!
+    //! @complexity Constant.
+    [[nodiscard]] bool operator==(const const_iterator &other) const noexcept
+    {
+      return (path.empty() ? nullptr : path.back().node) ==
+             (other.path.empty() ? nullptr : other.path.back().node);
+    }
+
+    //! @}
+
+    //! @name Internal Implementation Member Functions
+    //! @{
+
+    //! @brief Moves past the subtree of the element.
+    //!
+    //! @details Moves to the next sibling of the element or of its nearest
+    //! ancestor, or to the end.
+    void skip()
+    {
+      while (!path.empty()) {
+        const internal_step_type step{ path.back() };
+        path.pop_back();
+        if (path.empty()) {
+          break;
+        }
+        if (const internal_node_type *parent = path.back().node;
+            step.index + 1 < parent->children.size()) {
+          path.push_back({ parent->children[step.index + 1], step.index + 1 });
+          break;
+        }
+      }
+    }
+
+    //! @}
+
+    //! @name Internal Implementation Member Variables
+    //! @{
+
+    //! @brief The internal path from the root to the node represented by the
+    //! iterator. The ending iterator has an empty path.
+    internal_path_type path;
+
+    //! @}
+  };
+
+  //! @brief The type to traverse the elements of the container. The elements
+  //! are modified through the container.
+  using iterator = const_iterator;
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief Constructs an empty container.
+  //!
+  //! @param allocator The allocator to use for all memory allocations of this
+  //! container.
+  //!
+  //! @complexity Constant.
+  explicit cow_tree(const Allocator &allocator = Allocator{}) noexcept
+          : node_allocator{ allocator }
+  {
+  }
+
+  //! @brief Copy constructs a container sharing the nodes of the other
+  //! container.
+  //!
+  //! @details The nodes are copied if the allocator obtained as if by calling
+  //! `std::allocator_traits<Allocator>::
+  //! select_on_container_copy_construction(other.get_allocator())` does not
+  //! compare equal to the allocator of the other container.
+  //!
+  //! @param other The other container to share.
+  //!
+  //! @complexity Constant. Linear in the size of the other container if the
+  //! nodes are copied.
+  cow_tree(const cow_tree &other)
+          : node_allocator{
+              std::allocator_traits<internal_node_allocator_type>::
+                  select_on_container_copy_construction(other.node_allocator)
+            },
+            root{ share(other) }
+  {
+  }
+
+  //! @brief Move constructs a container with the nodes of the other
+  //! container.
+  //!
+  //! @details The other container is empty after the move.
+  //!
+  //! @param other The other container to move from.
+  //!
+  //! @complexity Constant.
+  cow_tree(cow_tree &&other) noexcept
+          : node_allocator{ std::move(other.node_allocator) },
+            root{ std::exchange(other.root, nullptr) }
+  {
+  }
+
+  //! @brief Constructs a container with the copy of the elements of a tree.
+  //!
+  //! @details The topology and the values of the tree are copied.
+  //!
+  //! @tparam NodePolicy The node policy type template parameter of the tree.
+  //!
+  //! @param other The tree to copy.
+  //! @param allocator The allocator to use for all memory allocations of this
+  //! container.
+  //!
+  //! @complexity Linear in the size of the other container.
+  template <typename NodePolicy>
+  explicit cow_tree(const tree<Type, Allocator, NodePolicy> &other,
+                    const Allocator &allocator = Allocator{})
+          : node_allocator{ allocator },
+            root{ copy(other.begin().node,
+                       [](const auto *node, const auto &visit) {
+                         for (const auto *child = node->first_child; child;
+                              child = child->right_sibling) {
+                           visit(child);
+                         }
+                       }) }
+  {
+  }
+
+  //! @brief Copy assigns the other container.
+  //!
+  //! @details The nodes of the other container are shared, or copied if the
+  //! allocators do not compare equal.
+  //!
+  //! @param other The other container to share.
+  //!
+  //! @return The reference to this container.
+  //!
+  //! @complexity Linear in the size of the released nodes of this container.
+  //! Linear in the size of the other container if the nodes are copied.
+  cow_tree &operator=(const cow_tree &other)
+  {
+    if (this != std::addressof(other)) {
+      internal_node_type *previous = root;
+      if constexpr (std::allocator_traits<internal_node_allocator_type>::
+                        propagate_on_container_copy_assignment::value) {
+        // The previous nodes are released by the previous allocator.
+        internal_node_allocator_type previous_allocator{ node_allocator };
+        node_allocator = other.node_allocator;
+        root = share(other);
+        release(previous, previous_allocator);
+      } else {
+        root = share(other);
+        release(previous, node_allocator);
+      }
+    }
+
+    return *this;
+  }
+
+  //! @brief Move assigns the other container.
+  //!
+  //! @details The nodes of the other container are moved, or copied if the
+  //! allocators do not propagate nor compare equal.
+  //!
+  //! @param other The other container to move from.
+  //!
+  //! @return The reference to this container.
+  //!
+  //! @complexity Linear in the size of the released nodes of this container.
+  //! Linear in the size of the other container if the nodes are copied.
+  cow_tree &operator=(cow_tree &&other)
+  {
+    if (this != std::addressof(other)) {
+      if constexpr (std::allocator_traits<internal_node_allocator_type>::
+                        propagate_on_container_move_assignment::value) {
+        release(std::exchange(root, nullptr), node_allocator);
+        node_allocator = std::move(other.node_allocator);
+        root = std::exchange(other.root, nullptr);
+      } else {
+        internal_node_type *previous = root;
+        root = node_allocator == other.node_allocator
+                   ? std::exchange(other.root, nullptr)
+                   : share(other);
+        release(previous, node_allocator);
+      }
+    }
+
+    return *this;
+  }
+
+  //! @brief Destructs the container.
+  //!
+  //! @details The nodes no longer shared are destroyed.
+  //!
+  //! @complexity Linear in the size of the released nodes.
+  ~cow_tree()
+  {
+    release(root, node_allocator);
+  }
+
+  //! @brief Returns the allocator associated with the container.
+  //!
+  //! @return The associated allocator.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] allocator_type get_allocator() const noexcept
+  {
+    return allocator_type{ node_allocator };
+  }
+
+  //! @}
+
+  //! @name Public Iterators Member Functions
+  //! @{
+
+  //! @brief Returns an iterator to the first element of the container.
+  //!
+  //! @return Iterator to the first element.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] const_iterator begin() const
+  {
+    const_iterator iterator{ internal_path_type{
+        typename internal_path_type::allocator_type{ node_allocator } } };
+    if (root) {
+      iterator.path.push_back({ root, 0 });
+    }
+
+    return iterator;
+  }
+
+  //! @brief Returns an iterator to the first element of the container.
+  //!
+  //! @return Iterator to the first element.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] const_iterator cbegin() const
+  {
+    return begin();
+  }
+
+  //! @brief Returns an iterator to the element following the last element of
+  //! the container.
+  //!
+  //! @return Iterator to the element following the last element.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] const_iterator end() const
+  {
+    return { internal_path_type{
+        typename internal_path_type::allocator_type{ node_allocator } } };
+  }
+
+  //! @brief Returns an iterator to the element following the last element of
+  //! the container.
+  //!
+  //! @return Iterator to the element following the last element.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] const_iterator cend() const
+  {
+    return end();
+  }
+
+  //! @}
+
+  //! @name Public Capacity Member Functions
+  //! @{
+
+  //! @brief Checks if the container has no elements.
+  //!
+  //! @return `true` if the container is empty, `false` otherwise.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] bool empty() const noexcept
+  {
+    return !root;
+  }
+
+  //! @brief Returns the number of elements in the container.
+  //!
+  //! @return The number of elements in the container.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] size_type size() const noexcept
+  {
+    return root ? root->count : 0;
+  }
+
+  //! @brief Checks if the container shares its root with another container.
+  //!
+  //! @return `true` if the root is shared, `false` otherwise.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] bool shared() const noexcept
+  {
+    return root && root->references.load(std::memory_order_acquire) != 1;
+  }
+
+  //! @}
+
+  //! @name Public Modifier Member Functions
+  //! @{
+
+  //! @brief Erases all elements from the container.
+  //!
+  //! @complexity Linear in the size of the released nodes.
+  void clear() noexcept
+  {
+    release(std::exchange(root, nullptr), node_allocator);
+  }
+
+  //! @brief Inserts a constructed in-place element into the container before
+  //! the `position` iterator as the new left sibling.
+  //!
+  //! @details Follows the `fcarouge::tree` container's `emplace` modifier
+  //! semantics. Inserts before the root position as the new root. Inserts
+  //! before the ending `end()` position as the last child of the root, or as
+  //! the root if the container is empty.
+  //!
+  //! @tparam Arguments The arguments type template parameter pack to forward to
+  //! the constructor of the element.
+  //!
+  //! @param position The iterator before which the new element will be
+  //! constructed. The iterator may be the beginning `begin()` or ending
+  //! `end()` iterator.
+  //! @param arguments The arguments to forward to the constructor of the
+  //! element.
+  //!
+  //! @return The iterator pointing to the inserted element.
+  //!
+  //! @complexity Linear in the number of children of the ancestors of the new
+  //! element.
+  template <typename... Arguments>
+  const_iterator emplace(const_iterator position, Arguments &&... arguments)
+  {
+    // Insert the new node...
+    // ...as the last child of the root node...
+    if (position.path.empty()) {
+      if (root) {
+        position.path.push_back({ root, 0 });
+        return adopt(std::move(position), root->children.size(),
+                     std::forward<Arguments>(arguments)...);
+      }
+    }
+    // ...as the left sibling of the position node...
+    else if (position.path.size() > 1) {
+      const size_type index{ position.path.back().index };
+      position.path.pop_back();
+      return adopt(std::move(position), index,
+                   std::forward<Arguments>(arguments)...);
+    }
+
+    // ...as the new root.
+    return emplace_front(std::forward<Arguments>(arguments)...);
+  }
+
+  //! @brief Inserts a constructed in-place element into the container before
+  //! the root beginning as the new root.
+  //!
+  //! @details The previous root, if any, becomes the sole child of the new
+  //! root.
+  //!
+  //! @tparam Arguments The arguments type template parameter pack to forward to
+  //! the constructor of the element.
+  //!
+  //! @param arguments The arguments to forward to the constructor of the
+  //! element.
+  //!
+  //! @return The iterator pointing to the inserted element.
+  //!
+  //! @complexity Constant.
+  template <typename... Arguments>
+  const_iterator emplace_front(Arguments &&... arguments)
+  {
+    internal_node_type *node = make(std::forward<Arguments>(arguments)...);
+    if (root) {
+      try {
+        node->children.push_back(root);
+      } catch (...) {
+        release(node, node_allocator);
+        throw;
+      }
+      node->count += root->count;
+    }
+    root = node;
+
+    return begin();
+  }
+
+  //! @brief Inserts a copied element into the container after the last child
+  //! of the `position` iterator as the new last child.
+  //!
+  //! @details Follows the `fcarouge::tree` container's `push` modifier
+  //! semantics. Inserts after the ending `end()` position as the last child of
+  //! the root, or as the root if the container is empty.
+  //!
+  //! @param position The parent element iterator for which the element will be
+  //! inserted as the last child.
+  //! @param value The value of the element to insert.
+  //!
+  //! @return The iterator pointing to the inserted element.
+  //!
+  //! @complexity Linear in the number of children of the new element's
+  //! ancestors.
+  const_iterator push(const_iterator position, const value_type &value)
+  {
+    return push_last_child(std::move(position), value);
+  }
+
+  //! @brief Inserts a moved element into the container after the last child
+  //! of the `position` iterator as the new last child.
+  //!
+  //! @details Follows the `fcarouge::tree` container's `push` modifier
+  //! semantics. Inserts after the ending `end()` position as the last child of
+  //! the root, or as the root if the container is empty.
+  //!
+  //! @param position The parent element iterator for which the element will be
+  //! inserted as the last child.
+  //! @param value The value of the element to insert.
+  //!
+  //! @return The iterator pointing to the inserted element.
+  //!
+  //! @complexity Linear in the number of children of the new element's
+  //! ancestors.
+  const_iterator push(const_iterator position, value_type &&value)
+  {
+    return push_last_child(std::move(position), std::move(value));
+  }
+
+  //! @brief Removes the specified element including its sub-tree.
+  //!
+  //! @details The nodes of the sub-tree no longer shared are destroyed. The
+  //! iterator `position` must be valid and dereferenceable. If the erased node
+  //! is the root, the container is empty.
+  //!
+  //! @param position The iterator to the element to remove with its subtree.
+  //!
+  //! @return Iterator following the last removed element. If `position` refers
+  //! to the last element, then the `end()` iterator is returned.
+  //!
+  //! @complexity Linear in the number of children of the ancestors of the
+  //! removed element, and in the size of the released nodes.
+  const_iterator erase(const_iterator position)
+  {
+    // Erase the root and the tree...
+    if (position.path.size() == 1) {
+      clear();
+      return end();
+    }
+
+    // ...or separate the subtree from its uniquely owned parent...
+    const size_type index{ position.path.back().index };
+    position.path.pop_back();
+    own(position.path);
+    internal_node_type *parent = position.path.back().node;
+    internal_node_type *node = parent->children[index];
+    parent->children.erase(std::next(parent->children.begin(),
+                                     static_cast<difference_type>(index)));
+    for (internal_step_type &step : position.path) {
+      step.node->count -= node->count;
+    }
+    release(node, node_allocator);
+
+    // ...and move past the subtree.
+    if (index < parent->children.size()) {
+      position.path.push_back({ parent->children[index], index });
+    } else {
+      position.skip();
+    }
+
+    return position;
+  }
+
+  //! @brief Modifies the value of an element.
+  //!
+  //! @details The checked accessor to the values of the elements. The shared
+  //! nodes on the path from the root to the element are cloned, then the
+  //! function is invoked with the reference to the value of the element. The
+  //! behavior is undefined if the iterator is not a dereferenceable iterator
+  //! of the container.
+  //!
+  //! @tparam Function The type template parameter of the modifying function.
+  //!
+  //! @param position The iterator to the element to modify.
+  //! @param function The function invoked with the reference to the value.
+  //!
+  //! @return The iterator pointing to the modified element.
+  //!
+  //! @complexity Linear in the number of children of the element and of its
+  //! ancestors.
+  template <typename Function>
+  const_iterator modify(const_iterator position, Function &&function)
+  {
+    own(position.path);
+    std::invoke(std::forward<Function>(function),
+                position.path.back().node->data);
+
+    return position;
+  }
+
+  //! @}
+
+  private:
+  //! @name Private Member Functions
+  //! @{
+
+  //! @brief Constructs a sole referenced leaf node.
+  //!
+  //! @tparam Arguments The arguments type template parameter pack to forward to
+  //! the constructor of the element.
+  //!
+  //! @param arguments The arguments to forward to the constructor of the
+  //! element.
+  //!
+  //! @return The constructed node.
+  template <typename... Arguments> internal_node_type *make(Arguments &&...
+                                                                arguments)
+  {
+    using traits = std::allocator_traits<internal_node_allocator_type>;
+    internal_node_type *node = traits::allocate(node_allocator, 1);
+    try {
+      traits::construct(node_allocator, node,
+                        typename internal_children_type::allocator_type{
+                            node_allocator },
+                        std::forward<Arguments>(arguments)...);
+    } catch (...) {
+      traits::deallocate(node_allocator, node, 1);
+      throw;
+    }
+
+    return node;
+  }
+
+  //! @brief Releases a reference to a node.
+  //!
+  //! @details The nodes no longer referenced are destroyed with the references
+  //! to their children, without recursion.
+  //!
+  //! @param node The node to release, if any.
+  //! @param allocator The allocator of the node.
+  static void release(internal_node_type *node,
+                      internal_node_allocator_type &allocator) noexcept
+  {
+    using traits = std::allocator_traits<internal_node_allocator_type>;
+    internal_children_type pending{ typename internal_children_type::
+                                        allocator_type{ allocator } };
+    while (node) {
+      if (node->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        // The released node hands its references over to the pending nodes,
+        // or releases them in place would the pending nodes not grow.
+        for (internal_node_type *child : node->children) {
+          try {
+            pending.push_back(child);
+          } catch (...) {
+            release(child, allocator);
+          }
+        }
+        traits::destroy(allocator, node);
+        traits::deallocate(allocator, node, 1);
+      }
+      node = nullptr;
+      if (!pending.empty()) {
+        node = pending.back();
+        pending.pop_back();
+      }
+    }
+  }
+
+  //! @brief Shares or copies the nodes of the other container.
+  //!
+  //! @param other The other container whose nodes to share.
+  //!
+  //! @return The shared or copied root.
+  internal_node_type *share(const cow_tree &other)
+  {
+    if (node_allocator == other.node_allocator) {
+      if (other.root) {
+        other.root->references.fetch_add(1, std::memory_order_relaxed);
+      }
+      return other.root;
+    }
+
+    return copy(other.root, [](const auto *node, const auto &visit) {
+      for (const internal_node_type *child : node->children) {
+        visit(child);
+      }
+    });
+  }
+
+  //! @brief Copies the nodes of a subtree.
+  //!
+  //! @details The nodes are copied in a pre-order walk without recursion, then
+  //! their subtree sizes are accumulated in reverse order.
+  //!
+  //! @tparam Node The node type of the subtree to copy.
+  //! @tparam Children The type of the children visitor.
+  //!
+  //! @param other_root The root of the subtree to copy, if any.
+  //! @param children The function visiting the children of a node from left to
+  //! right.
+  //!
+  //! @return The root of the copy.
+  //!
+  //! @complexity Linear in the size of the subtree.
+  template <typename Node, typename Children>
+  internal_node_type *copy(const Node *other_root, Children children)
+  {
+    if (!other_root) {
+      return nullptr;
+    }
+
+    internal_node_type *copy_root = make(other_root->data);
+    try {
+      using pair_type = std::pair<const Node *, internal_node_type *>;
+      using pair_allocator_type = typename std::allocator_traits<
+          Allocator>::template rebind_alloc<pair_type>;
+      std::vector<pair_type, pair_allocator_type> pending{ pair_allocator_type{
+          node_allocator } };
+      pending.push_back({ other_root, copy_root });
+      internal_children_type order{
+        typename internal_children_type::allocator_type{ node_allocator }
+      };
+      while (!pending.empty()) {
+        const auto [other, node] = pending.back();
+        pending.pop_back();
+        order.push_back(node);
+        children(other, [this, &pending, node](const Node *other_child) {
+          node->children.push_back(nullptr);
+          node->children.back() = make(other_child->data);
+          pending.push_back({ other_child, node->children.back() });
+        });
+      }
+      for (auto node = order.rbegin(); node != order.rend(); ++node) {
+        for (const internal_node_type *child : (*node)->children) {
+          (*node)->count += child->count;
+        }
+      }
+    } catch (...) {
+      release(copy_root, node_allocator);
+      throw;
+    }
+
+    return copy_root;
+  }
+
+  //! @brief Owns the nodes of a path uniquely.
+  //!
+  //! @details The shared nodes of the path, from the root, are replaced by
+  //! their clones holding an additional reference to their children. The path
+  //! is updated with the owned nodes.
+  //!
+  //! @param path The path from the root to own.
+  //!
+  //! @complexity Linear in the number of children of the shared nodes of the
+  //! path.
+  void own(internal_path_type &path)
+  {
+    internal_node_type *parent = nullptr;
+    for (internal_step_type &step : path) {
+      internal_node_type *&link =
+          parent ? parent->children[step.index] : root;
+      if (link->references.load(std::memory_order_acquire) != 1) {
+        internal_node_type *clone = make(link->data);
+        try {
+          clone->children = link->children;
+        } catch (...) {
+          release(clone, node_allocator);
+          throw;
+        }
+        clone->count = link->count;
+        for (internal_node_type *child : clone->children) {
+          child->references.fetch_add(1, std::memory_order_relaxed);
+        }
+        // The link may no longer be shared since its reference count was
+        // loaded.
+        release(std::exchange(link, clone), node_allocator);
+      }
+      step.node = parent = link;
+    }
+  }
+
+  //! @brief Inserts a new node as a child of the node at the end of a path.
+  //!
+  //! @tparam Arguments The arguments type template parameter pack to forward to
+  //! the constructor of the element.
+  //!
+  //! @param position The iterator to the parent of the new node.
+  //! @param index The index of the new node in the children of its parent.
+  //! @param arguments The arguments to forward to the constructor of the
+  //! element.
+  //!
+  //! @return The iterator pointing to the inserted element.
+  template <typename... Arguments>
+  const_iterator adopt(const_iterator position, size_type index,
+                       Arguments &&... arguments)
+  {
+    own(position.path);
+    internal_node_type *parent = position.path.back().node;
+    position.path.reserve(position.path.size() + 1);
+    internal_node_type *node = make(std::forward<Arguments>(arguments)...);
+    try {
+      parent->children.insert(std::next(parent->children.begin(),
+                                        static_cast<difference_type>(index)),
+                              node);
+    } catch (...) {
+      release(node, node_allocator);
+      throw;
+    }
+    for (internal_step_type &step : position.path) {
+      ++step.node->count;
+    }
+    position.path.push_back({ node, index });
+
+    return position;
+  }
+
+  //! @brief Inserts a new node as the last child of the position node.
+  //!
+  //! @tparam Value The type template parameter of the value to forward.
+  //!
+  //! @param position The parent element iterator.
+  //! @param value The value of the element to insert.
+  //!
+  //! @return The iterator pointing to the inserted element.
+  template <typename Value>
+  const_iterator push_last_child(const_iterator position, Value &&value)
+  {
+    if (position.path.empty()) {
+      if (!root) {
+        return emplace_front(std::forward<Value>(value));
+      }
+      position.path.push_back({ root, 0 });
+    }
+    const size_type index{ position.path.back().node->children.size() };
+
+    return adopt(std::move(position), index, std::forward<Value>(value));
+  }
+
+  //! @}
+
+  //! @name Private Member Variables
+  //! @{
+
+  //! @brief The allocator of the nodes.
+  [[no_unique_address]] internal_node_allocator_type node_allocator;
+
+  //! @brief The root node of the container, if any.
+  internal_node_type *root = nullptr;
+
+  //! @}
+};
+} // namespace fcarouge
+
+//! @brief Compares the contents of two containers.
+//!
+//! @details Checks if the contents of `lhs` and `rhs` are equal, that is, they
+//! have the same number of elements and each element in `lhs` compares equal
+//! with the element in `rhs` at the same position.
+//!
+//! @param lhs Tree whose contents to compare.
+//! @param rhs Tree whose contents to compare.
+//!
+//! @return `true` if the contents of the containers are equal, `false`
+//! otherwise.
+//!
+//! @complexity Linear in the size of the container. Constant if the size of the
+//! compared containers are different, linear otherwise.
+template <typename Type, typename Allocator>
+[[nodiscard]] bool operator==(const fcarouge::cow_tree<Type, Allocator> &lhs,
+                              const fcarouge::cow_tree<Type, Allocator> &rhs)
+{
+  return std::addressof(lhs) == std::addressof(rhs) ||
+         (lhs.size() == rhs.size() &&
+          std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin()));
+}
+
+//! @brief Inserts a human-interpretable representation of a container into a
+//! character stream.
+//!
+//! @details The representation is the same as the `fcarouge::tree`
+//! container's representation of the same topology and values.
+//!
+//! @tparam Char The type template parameter of the character of the stream.
+//! @tparam Traits The character type template parameter operations
+//! specification class.
+//! @tparam Type The type template parameter of the contained data in the tree
+//! elements.
+//! @tparam Allocator The type template parameter of the allocator for the nodes
+//! of the tree elements.
+//!
+//! @param output_stream The character stream to write to.
+//! @param tree The tree to be written.
+//!
+//! @return The character stream `output_stream` that was operated on.
+template <typename Char, typename Traits, typename Type, typename Allocator>
+std::basic_ostream<Char, Traits> &
+operator<<(std::basic_ostream<Char, Traits> &output_stream,
+           const fcarouge::cow_tree<Type, Allocator> &tree)
+{
+  // If there is a root...
+  if (auto position = tree.begin(); position != tree.end()) {
+    // ...insert the root's representation in the stream...
+    output_stream << *position;
+    output_stream.put(output_stream.widen('\n'));
+
+    // ...by using a character queue to contain the indented topology of the
+    // ancestors of the position, growing, shrinking, while walking the tree...
+    using margin_allocator_type =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<char>;
+    std::basic_string<Char, Traits, margin_allocator_type> margin;
+
+    auto pop4_utf8 = [&margin]() {
+      for (auto character_count = 4; character_count--;) {
+        if (!margin.empty()) {
+          constexpr unsigned char utf8_mask = 0xC0u;
+          constexpr unsigned char utf8_point = 0x80u;
+          while (!((static_cast<unsigned char>(margin.back()) & utf8_mask) !=
+                   utf8_point)) {
+            margin.pop_back();
+          }
+          margin.pop_back();
+        }
+      }
+    };
+
+    // A node of the path has a right sibling if it is not the last child of
+    // the previous node of the path.
+    auto right_sibling = [](const auto &path, std::size_t depth) {
+      return path[depth].index + 1 < path[depth - 1].node->children.size();
+    };
+
+    // ...for every node to insert its representation...
+    for (std::size_t columns{ 0 }; ++position != tree.end();) {
+      const auto &path = position.path;
+      // ...shrinking the margin to the common ancestors of the previous node...
+      for (; columns > path.size() - 2; --columns) {
+        pop4_utf8();
+      }
+      // ...growing the margin with the columns of the other ancestors...
+      for (; columns < path.size() - 2; ++columns) {
+        if (right_sibling(path, columns + 1)) {
+          margin.append("│   ");
+        } else {
+          margin.append("    ");
+        }
+      }
+      // ...insert the node's representation in the stream.
+      output_stream << margin.c_str();
+      if (right_sibling(path, path.size() - 1)) {
+        output_stream << "├── ";
+      } else {
+        output_stream << "└── ";
+      }
+      output_stream << *position;
+      output_stream.put(output_stream.widen('\n'));
+    }
+  }
+
+  return output_stream;
+}
+
+#endif // FCAROUGE_COW_TREE_HPP
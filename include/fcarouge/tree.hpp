@@ -33,21 +33,37 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #define FCAROUGE_TREE_HPP
 
 #include <algorithm>
-// std::equal std::min
+// std::clamp std::equal std::max std::min std::ranges::upper_bound
+// std::ranges::upper_bound
 
 #include <cstddef>
 // std::ptrdiff_t std::size_t
 
+#include <cstdint>
+// std::uint64_t std::uintptr_t
+
+#include <cstring>
+// std::memcpy
+
 #include <iterator>
-// std::input_iterator_tag
+// std::input_iterator_tag std::prev std::reverse_iterator
 
 #include <limits>
 // std::numeric_limits
 
+#include <functional>
+// std::less
+
 #include <memory>
 // std::addressof std::allocator std::allocator_traits
 // std::construct_at std::destroy_at std::pointer_traits
 
+#include <mutex>
+// std::lock_guard std::mutex
+
+#include <new>
+// std::bad_alloc
+
 #include <ostream>
 // std::basic_ostream
 
@@ -55,10 +71,17 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 // std::basic_string
 
 #include <type_traits>
-// std::is_same_v
+// std::conditional_t std::is_same_v std::is_trivially_copyable_v
 
 #include <utility>
-// std::forward std::move
+// std::exchange std::forward std::move
+
+#include <vector>
+// std::vector
+
+#include "tree_execution.hpp"
+
+#include "tree_iterator.hpp"
 
 #include "tree_iterator_fwd.hpp"
 
@@ -105,7 +128,10 @@ namespace fcarouge
 //! acquire/release memory and to construct/destroy the elements in that memory.
 //! The allocator type must meet the Allocator requirements. The type of value
 //! of the allocator must match the type of the value of the container.
-template <typename Type, typename Allocator> class tree
+//! @tparam NodePolicy The node policy type template parameter opting in the
+//! caches maintained in every node of the container, none by default. See
+//! `node_policy`.
+template <typename Type, typename Allocator, typename NodePolicy> class tree
 {
   public:
   static_assert(std::is_same_v<Type, typename Allocator::value_type>,
@@ -148,6 +174,16 @@ template <typename Type, typename Allocator> class tree
   //! @name Private Member Types
   //! @{
 
+  //! @brief Absent node cache data structure type.
+  //!
+  //! @details The empty placeholder of a node cache not opted in by the node
+  //! policy. The tag distinguishes the placeholders of a node so that none of
+  //! them takes storage.
+  //!
+  //! @tparam Tag The non-type template parameter of the placeholder tag.
+  template <int Tag> struct internal_absent_type {
+  };
+
   //! @brief Branch node data structure type.
   //!
   //! @details The internal implementation details of the node data structure
@@ -184,6 +220,139 @@ template <typename Type, typename Allocator> class tree
       return nullptr;
     }
 
+    //! @brief Finds the next node in pre-order.
+    //!
+    //! @details Loads the successor thread with the thread node policy.
+    //! Otherwise, descends to the first child or climbs to the nearest right
+    //! sibling of itself or ancestor.
+    //!
+    //! @return The pointer to the pre-order successor; or `nullptr` if such a
+    //! node doesn't exist.
+    //!
+    //! @complexity Constant with the thread node policy, linear in the height
+    //! of the container otherwise.
+    [[nodiscard]] constexpr internal_node_type *next() const noexcept
+    {
+      if constexpr (NodePolicy::thread) {
+        return successor;
+      } else {
+        return first_child ? first_child : next_ancestor_sibling();
+      }
+    }
+
+    //! @brief Finds the last node of its subtree in pre-order.
+    //!
+    //! @details Walks the last children down the subtree.
+    //!
+    //! @return The pointer to the deepest last descendant, or itself if it has
+    //! no children.
+    [[nodiscard]] constexpr internal_node_type *last_descendant() noexcept
+    {
+      internal_node_type *current = this;
+      while (current->last_child) {
+        current = current->last_child;
+      }
+
+      return current;
+    }
+
+    //! @}
+
+    //! @name Public Order Member Functions
+    //! @{
+
+    //! @brief Checks whether the node is an ancestor of another node.
+    //!
+    //! @details Compares the order-maintenance labels with the order node
+    //! policy, or walks the ancestors of the other node otherwise. A node is
+    //! an ancestor of itself.
+    //!
+    //! @param node The pointer to the presumed descendant node.
+    //!
+    //! @return `true` if the node is an ancestor of the other node, `false`
+    //! otherwise.
+    //!
+    //! @complexity Constant with the order node policy, linear in the depth of
+    //! the other node otherwise.
+    [[nodiscard]] constexpr bool
+    encloses(const internal_node_type *node) const noexcept
+    {
+      if constexpr (NodePolicy::order) {
+        return entry_label <= node->entry_label &&
+               node->exit_label <= exit_label;
+      } else {
+        for (; node; node = node->parent) {
+          if (node == this) {
+            return true;
+          }
+        }
+
+        return false;
+      }
+    }
+
+    //! @brief Checks whether the node precedes another node in pre-order.
+    //!
+    //! @details Compares the order-maintenance labels of the entries with the
+    //! order node policy. Otherwise, walks both nodes up to the children of
+    //! their lowest common ancestor, and then the right siblings of the first
+    //! child reached.
+    //!
+    //! @param node The pointer to the other node.
+    //!
+    //! @return `true` if the node is visited before the other node in a
+    //! pre-order depth-first traversal, `false` otherwise.
+    //!
+    //! @complexity Constant with the order node policy, linear in the height
+    //! of the container and in the number of children of the lowest common
+    //! ancestor otherwise.
+    [[nodiscard]] constexpr bool
+    precedes(const internal_node_type *node) const noexcept
+    {
+      if constexpr (NodePolicy::order) {
+        return entry_label < node->entry_label;
+      } else {
+        // Walk the deepest node up to the depth of the other node...
+        difference_type depth = 0;
+        for (const internal_node_type *ancestor = this; ancestor->parent;
+             ancestor = ancestor->parent) {
+          ++depth;
+        }
+        for (const internal_node_type *ancestor = node; ancestor->parent;
+             ancestor = ancestor->parent) {
+          --depth;
+        }
+        const internal_node_type *lhs = this;
+        const internal_node_type *rhs = node;
+        for (; depth > 0; --depth) {
+          lhs = lhs->parent;
+        }
+        for (; depth < 0; ++depth) {
+          rhs = rhs->parent;
+        }
+
+        // ...where an ancestor precedes its descendants...
+        if (lhs == rhs) {
+          return lhs == this && this != node;
+        }
+
+        // ...otherwise walk both nodes up to sibling nodes...
+        while (lhs->parent != rhs->parent) {
+          lhs = lhs->parent;
+          rhs = rhs->parent;
+        }
+
+        // ...and search the other node among the right siblings.
+        while ((lhs = lhs->right_sibling)) {
+          if (lhs == rhs) {
+            return true;
+          }
+        }
+
+        return false;
+      }
+    }
+
     //! @}
 
     //! @name Public Member Variables
@@ -196,6 +365,175 @@ template <typename Type, typename Allocator> class tree
     internal_node_type *right_sibling = nullptr;
     internal_node_type *parent = nullptr;
 
+    //! @brief The cached level of the node in the hierarchy, with the level
+    //! node policy.
+    //!
+    //! @details The level is relative to the level of the root: the depth of
+    //! the node is its level minus the root's level. Prepending a new root
+    //! only decrements the new root's level which keeps the maintenance of
+    //! the cache constant on every insertion. Without the policy, the level
+    //! takes no storage.
+    [[no_unique_address]] std::conditional_t<
+        NodePolicy::level, difference_type, internal_absent_type<0>> level{};
+
+    //! @brief The order-maintenance labels of the entry to and the exit from
+    //! the node in an Euler tour of the container, with the order node
+    //! policy.
+    //!
+    //! @details The labels of every entry and exit are strictly increasing
+    //! along the tour. The entry labels order the nodes in pre-order and the
+    //! labels of a node enclose the labels of its descendants. Without the
+    //! policy, the labels take no storage.
+    [[no_unique_address]] std::conditional_t<NodePolicy::order, std::uint64_t,
+                                             internal_absent_type<1>>
+        entry_label{};
+    [[no_unique_address]] std::conditional_t<NodePolicy::order, std::uint64_t,
+                                             internal_absent_type<2>>
+        exit_label{};
+
+    //! @brief The cached pre-order successor thread of the node, with the
+    //! thread node policy.
+    //!
+    //! @details The node following this node in a depth-first pre-order
+    //! traversal, or `nullptr` for the last node. The thread is maintained on
+    //! every insertion and removal so that advancing in pre-order is a single
+    //! load instead of a climb of the ancestors. Without the policy, the
+    //! thread takes no storage.
+    [[no_unique_address]] std::conditional_t<
+        NodePolicy::thread, internal_node_type *, internal_absent_type<3>>
+        successor{};
+
+    //! @}
+  };
+
+  //! @brief Euler tour token data structure type.
+  //!
+  //! @details The entry to, or the exit from a node in the Euler tour of the
+  //! container. The neighbor tokens of a token are found from the links of its
+  //! node in constant time.
+  struct internal_token_type {
+    //! @name Public Observer Member Functions
+    //! @{
+
+    //! @brief Checks whether the token exists.
+    //!
+    //! @return `true` if the token refers to a node, `false` otherwise.
+    [[nodiscard]] constexpr explicit operator bool() const noexcept
+    {
+      return node;
+    }
+
+    //! @brief Accesses the order-maintenance label of the token.
+    //!
+    //! @return Reference to the label.
+    [[nodiscard]] constexpr std::uint64_t &label() const noexcept
+    {
+      return exit ? node->exit_label : node->entry_label;
+    }
+
+    //! @brief Finds the next token of the tour.
+    //!
+    //! @return The next token; or a null token if such a token doesn't exist.
+    [[nodiscard]] constexpr internal_token_type next() const noexcept
+    {
+      if (!exit) {
+        if (node->first_child) {
+          return { node->first_child, false };
+        }
+        return { node, true };
+      }
+      if (node->right_sibling) {
+        return { node->right_sibling, false };
+      }
+      return { node->parent, true };
+    }
+
+    //! @brief Finds the previous token of the tour.
+    //!
+    //! @return The previous token; or a null token if such a token doesn't
+    //! exist.
+    [[nodiscard]] constexpr internal_token_type previous() const noexcept
+    {
+      if (exit) {
+        if (node->last_child) {
+          return { node->last_child, true };
+        }
+        return { node, false };
+      }
+      if (node->left_sibling) {
+        return { node->left_sibling, true };
+      }
+      return { node->parent, false };
+    }
+
+    //! @}
+
+    //! @name Public Member Variables
+    //! @{
+
+    internal_node_type *node = nullptr;
+    bool exit = false;
+
+    //! @}
+  };
+
+  //! @brief Block of nodes data structure type.
+  //!
+  //! @details The nodes allocated at once by a bulk copy of a container. The
+  //! nodes of a block are destroyed one by one but their storage is
+  //! deallocated with the block, once all its slots are vacant or when the
+  //! container is cleared, assigned, or destroyed. The blocks of a container
+  //! form a binary search tree ordered by the addresses of their nodes.
+  struct internal_block_type {
+    //! @name Public Member Functions
+    //! @{
+
+    //! @brief Finds the first block of its subtree in address order.
+    //!
+    //! @return The pointer to the leftmost block of its subtree.
+    //!
+    //! @complexity Linear in the height of the blocks.
+    [[nodiscard]] constexpr const internal_block_type *first() const noexcept
+    {
+      const internal_block_type *block = this;
+      while (block->left) {
+        block = block->left;
+      }
+
+      return block;
+    }
+
+    //! @brief Finds the next block in address order.
+    //!
+    //! @return The pointer to the next block; or `nullptr` if such a block
+    //! doesn't exist.
+    //!
+    //! @complexity Amortized constant over a walk of the blocks.
+    [[nodiscard]] constexpr const internal_block_type *next() const noexcept
+    {
+      if (right) {
+        return right->first();
+      }
+      const internal_block_type *block = this;
+      while (block->parent && block->parent->right == block) {
+        block = block->parent;
+      }
+
+      return block->parent;
+    }
+
+    //! @}
+
+    //! @name Public Member Variables
+    //! @{
+
+    internal_node_type *nodes = nullptr;
+    std::size_t count = 0;
+    std::size_t vacant = 0;
+    internal_block_type *parent = nullptr;
+    internal_block_type *left = nullptr;
+    internal_block_type *right = nullptr;
+
     //! @}
   };
 
@@ -208,6 +546,11 @@ template <typename Type, typename Allocator> class tree
   using internal_node_allocator_traits =
       std::allocator_traits<internal_node_allocator_type>;
 
+  //! @brief The internal element allocator type rebind to internal block
+  //! allocator type.
+  using internal_block_allocator_type = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<internal_block_type>;
+
   //! @brief The internal iterator type definition.
   //!
   //! @tparam Const The non-type template parameter specialized to provide the
@@ -233,6 +576,9 @@ template <typename Type, typename Allocator> class tree
     //! @brief The LegacyForwardIterator requirements category of the iterator.
     using iterator_category = std::forward_iterator_tag;
 
+    //! @brief The container type of the iterator.
+    using container_type = tree;
+
     //! @}
 
     //! @name Public Observer Member Functions
@@ -270,13 +616,12 @@ template <typename Type, typename Allocator> class tree
     //! @brief Prefix increments the iterator.
     //!
     //! @return Reference to the next iterator.
+    //!
+    //! @complexity Constant with the thread node policy, linear in the height
+    //! of the container otherwise.
     constexpr internal_iterator_type &operator++() noexcept
     {
-      if (node->first_child) {
-        node = node->first_child;
-      } else {
-        node = node->next_ancestor_sibling();
-      }
+      node = node->next();
 
       return *this;
     }
@@ -284,14 +629,13 @@ template <typename Type, typename Allocator> class tree
     //! @brief Postfix increments the iterator.
     //!
     //! @return Next iterator.
+    //!
+    //! @complexity Constant with the thread node policy, linear in the height
+    //! of the container otherwise.
     constexpr internal_iterator_type operator++(int) noexcept
     {
       internal_iterator_type temporary_iterator = *this;
-      if (node->first_child) {
-        node = node->first_child;
-      } else {
-        node = node->next_ancestor_sibling();
-      }
+      node = node->next();
 
       return temporary_iterator;
     }
@@ -383,6 +727,16 @@ template <typename Type, typename Allocator> class tree
   // iterator.
   using const_iterator = internal_iterator_type<true>;
 
+  //! @brief Type to traverse the elements of the container in reverse
+  //! depth-first pre-order.
+  using reverse_iterator =
+      std::reverse_iterator<depth_first_pre_order_iterator_type<iterator>>;
+
+  //! @brief Type to traverse the elements of the constant container in reverse
+  //! depth-first pre-order.
+  using const_reverse_iterator = std::reverse_iterator<
+      depth_first_pre_order_iterator_type<const_iterator>>;
+
   //! @brief The node handle type of the container.
   //!
   //! @details Specialization of node handle.
@@ -450,7 +804,8 @@ template <typename Type, typename Allocator> class tree
           : node_allocator{ std::allocator_traits<Allocator>::
                                 select_on_container_copy_construction(
                                     other.node_allocator) },
-            root{ copy(other.root) }, node_count{ other.node_count }
+            root{ copy(other) },
+            node_count{ other.node_count }
   {
   }
 
@@ -466,12 +821,42 @@ template <typename Type, typename Allocator> class tree
   //!
   //! @complexity Linear in size of the other container.
   constexpr tree(const tree &other, const Allocator &allocator)
-          : node_allocator{ allocator }, root{ copy(other.root) }, node_count{
+          : node_allocator{ allocator },
+            root{ copy(other) }, node_count{
               other.node_count
             }
   {
   }
 
+  //! @brief Copy constructs a container in parallel.
+  //!
+  //! @details Constructs the container with the copy of the contents of the
+  //! `other` container. The subtrees of the other container are copied by a
+  //! team of threads that steal the uncopied child subtrees of each other.
+  //! Every thread constructs its nodes in slabs of its own, carved by the
+  //! team one at a time from shared blocks, and links its copies to the copied
+  //! parents. The copy scales with the number of threads on bushy containers
+  //! and degrades to a sequential copy on chains. The first exception thrown
+  //! by a copy or an allocation destroys the copied elements and is rethrown.
+  //!
+  //! @param policy The parallel execution policy.
+  //! @param other Another container to be used as source to initialize the
+  //! elements of the container with.
+  //!
+  //! @note Allocator is obtained as if by calling:
+  //! `std::allocator_traits<Allocator>::
+  //! select_on_container_copy_construction(other.get_allocator())`
+  //!
+  //! @complexity Linear in size of the other container.
+  tree(const parallel_policy &policy, const tree &other)
+          : node_allocator{ std::allocator_traits<Allocator>::
+                                select_on_container_copy_construction(
+                                    other.node_allocator) },
+            root{ copy(policy, other.root, other.node_count) },
+            node_count{ other.node_count }
+  {
+  }
+
   //! @brief Move constructs a container.
   //!
   //! @details Move constructor. Constructs the container with the contents of
@@ -485,9 +870,13 @@ template <typename Type, typename Allocator> class tree
   //! @complexity Constant.
   constexpr tree(tree &&other) noexcept
           : node_allocator{ std::move(other.node_allocator) },
+            blocks{ other.blocks }, vacant_count{ other.vacant_count },
             root{ other.root }, node_count{ other.node_count }
   {
+    other.blocks = nullptr;
+    other.vacant_count = 0;
     other.root = nullptr;
+    ++other.revision_count;
   }
 
   //! @brief Allocator-extended move constructor.
@@ -508,10 +897,15 @@ template <typename Type, typename Allocator> class tree
           : node_allocator{ allocator }, node_count{ other.node_count }
   {
     if (allocator != other.node_allocator) {
-      root = copy(other.root);
+      root = copy(other);
     } else {
+      blocks = other.blocks;
+      vacant_count = other.vacant_count;
       root = other.root;
+      other.blocks = nullptr;
+      other.vacant_count = 0;
       other.root = nullptr;
+      ++other.revision_count;
     }
   }
 
@@ -524,6 +918,7 @@ template <typename Type, typename Allocator> class tree
           : root{ node_allocator.allocate(1) }, node_count{ 1 }
   {
     std::construct_at(root, value);
+    order(root);
   }
 
   //! @brief Constructs the container with by copying the value for its root.
@@ -538,6 +933,7 @@ template <typename Type, typename Allocator> class tree
             node_count{ 1 }
   {
     std::construct_at(root, value);
+    order(root);
   }
 
   //! @brief Constructs the container by moving the value for its root.
@@ -549,6 +945,7 @@ template <typename Type, typename Allocator> class tree
           : root{ node_allocator.allocate(1) }, node_count{ 1 }
   {
     std::construct_at(root, std::move(value));
+    order(root);
   }
 
   //! @brief Constructs the container by moving the value for its root.
@@ -563,6 +960,7 @@ template <typename Type, typename Allocator> class tree
             node_count{ 1 }
   {
     std::construct_at(root, std::move(value));
+    order(root);
   }
 
   //! @brief Destructs the container.
@@ -579,6 +977,7 @@ template <typename Type, typename Allocator> class tree
   constexpr ~tree() noexcept
   {
     axe(root);
+    release();
   }
 
   //! @brief Copy assignment operator.
@@ -598,10 +997,12 @@ template <typename Type, typename Allocator> class tree
   {
     if (this != std::addressof(other)) {
       axe(root);
+      release();
       node_allocator = std::allocator_traits<Allocator>::
           select_on_container_copy_construction(other.node_allocator);
-      root = copy(other.root);
+      root = copy(other);
       node_count = other.node_count;
+      ++revision_count;
     }
 
     return *this;
@@ -630,10 +1031,17 @@ template <typename Type, typename Allocator> class tree
   {
     if (this != std::addressof(other)) {
       axe(root);
+      release();
       node_allocator = std::move(other.node_allocator);
+      blocks = other.blocks;
+      vacant_count = other.vacant_count;
       root = other.root;
       node_count = other.node_count;
+      ++revision_count;
+      other.blocks = nullptr;
+      other.vacant_count = 0;
       other.root = nullptr;
+      ++other.revision_count;
     }
 
     return *this;
@@ -653,9 +1061,12 @@ template <typename Type, typename Allocator> class tree
   constexpr tree &operator=(const_reference value)
   {
     axe(root);
+    release();
     root = node_allocator.allocate(1);
     std::construct_at(root, value);
+    order(root);
     node_count = 1;
+    ++revision_count;
 
     return *this;
   }
@@ -675,9 +1086,12 @@ template <typename Type, typename Allocator> class tree
   constexpr tree &operator=(value_type &&value)
   {
     axe(root);
+    release();
     root = node_allocator.allocate(1);
     std::construct_at(root, std::move(value));
+    order(root);
     node_count = 1;
+    ++revision_count;
 
     return *this;
   }
@@ -699,10 +1113,12 @@ template <typename Type, typename Allocator> class tree
   {
     if (this != std::addressof(other)) {
       axe(root);
+      release();
       node_allocator = std::allocator_traits<Allocator>::
           select_on_container_copy_construction(other.node_allocator);
-      root = copy(other.root);
+      root = copy(other);
       node_count = other.node_count;
+      ++revision_count;
     }
 
     return *this;
@@ -731,10 +1147,17 @@ template <typename Type, typename Allocator> class tree
   {
     if (this != std::addressof(other)) {
       axe(root);
+      release();
       node_allocator = std::move(other.node_allocator);
+      blocks = other.blocks;
+      vacant_count = other.vacant_count;
       root = other.root;
       node_count = other.node_count;
+      ++revision_count;
+      other.blocks = nullptr;
+      other.vacant_count = 0;
       other.root = nullptr;
+      ++other.revision_count;
     }
 
     return *this;
@@ -754,9 +1177,12 @@ template <typename Type, typename Allocator> class tree
   constexpr tree &assign(const_reference value) noexcept
   {
     axe(root);
+    release();
     root = node_allocator.allocate(1);
     std::construct_at(root, value);
+    order(root);
     node_count = 1;
+    ++revision_count;
 
     return *this;
   }
@@ -776,9 +1202,12 @@ template <typename Type, typename Allocator> class tree
   constexpr tree &assign(value_type &&value) noexcept
   {
     axe(root);
+    release();
     root = node_allocator.allocate(1);
     std::construct_at(root, std::move(value));
+    order(root);
     node_count = 1;
+    ++revision_count;
 
     return *this;
   }
@@ -919,6 +1348,93 @@ template <typename Type, typename Allocator> class tree
     return {};
   }
 
+  //! @brief Returns a reverse iterator to the container's last element in
+  //! depth-first pre-order.
+  //!
+  //! @details The last element is the deepest last descendant of the root. If
+  //! the container is empty, the returned iterator will be equal to `rend()`.
+  //!
+  //! @return Reverse iterator to the last element.
+  //!
+  //! @complexity Constant. Dereferencing is linear in the height of the tree.
+  [[nodiscard]] constexpr reverse_iterator rbegin() noexcept
+  {
+    return reverse_iterator{ { nullptr, root } };
+  }
+
+  //! @brief Returns a constant container reverse iterator to the container's
+  //! last element in depth-first pre-order.
+  //!
+  //! @details If the container is empty, the returned iterator will be equal
+  //! to `rend()`.
+  //!
+  //! @return Constant reverse iterator to the last element.
+  //!
+  //! @complexity Constant. Dereferencing is linear in the height of the tree.
+  [[nodiscard]] constexpr const_reverse_iterator rbegin() const noexcept
+  {
+    return const_reverse_iterator{ { nullptr, root } };
+  }
+
+  //! @brief Returns a constant container reverse iterator to the container's
+  //! last element in depth-first pre-order.
+  //!
+  //! @details If the container is empty, the returned iterator will be equal
+  //! to `rend()`.
+  //!
+  //! @return Constant reverse iterator to the last element.
+  //!
+  //! @complexity Constant. Dereferencing is linear in the height of the tree.
+  [[nodiscard]] constexpr const_reverse_iterator crbegin() const noexcept
+  {
+    return const_reverse_iterator{ { nullptr, root } };
+  }
+
+  //! @brief Returns a reverse iterator to the element preceding the root in
+  //! depth-first pre-order.
+  //!
+  //! @details This element acts as a placeholder; attempting to access it
+  //! results in undefined behavior.
+  //!
+  //! @return Reverse iterator to the element following the last element of the
+  //! reverse traversal.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] constexpr reverse_iterator rend() noexcept
+  {
+    return reverse_iterator{ { root, root } };
+  }
+
+  //! @brief Returns a constant container reverse iterator to the element
+  //! preceding the root in depth-first pre-order.
+  //!
+  //! @details This element acts as a placeholder; attempting to access it
+  //! results in undefined behavior.
+  //!
+  //! @return Constant reverse iterator to the element following the last
+  //! element of the reverse traversal.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] constexpr const_reverse_iterator rend() const noexcept
+  {
+    return const_reverse_iterator{ { root, root } };
+  }
+
+  //! @brief Returns a constant container reverse iterator to the element
+  //! preceding the root in depth-first pre-order.
+  //!
+  //! @details This element acts as a placeholder; attempting to access it
+  //! results in undefined behavior.
+  //!
+  //! @return Constant reverse iterator to the element following the last
+  //! element of the reverse traversal.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] constexpr const_reverse_iterator crend() const noexcept
+  {
+    return const_reverse_iterator{ { root, root } };
+  }
+
   //! @}
 
   //! @name Public Capacity Member Functions
@@ -973,6 +1489,27 @@ template <typename Type, typename Allocator> class tree
 
   //! @}
 
+  //! @name Public Observer Member Functions
+  //! @{
+
+  //! @brief Returns the structural revision of the container.
+  //!
+  //! @details The revision changes on every operation that modifies the
+  //! topology of the container: insertions, erasures, clearing, and
+  //! assignments. Accessing or modifying the values of the elements does not
+  //! change the revision. Indexes built from the container compare revisions
+  //! to detect when they are outdated.
+  //!
+  //! @return The structural revision of the container.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] constexpr size_type revision() const noexcept
+  {
+    return revision_count;
+  }
+
+  //! @}
+
   //! @name Public Modifier Member Functions
   //! @{
 
@@ -990,8 +1527,10 @@ template <typename Type, typename Allocator> class tree
   constexpr void clear() noexcept
   {
     axe(root);
+    release();
     root = nullptr;
     node_count = 0;
+    ++revision_count;
   }
 
   //! @brief Inserts a copied element into the container before the `position`
@@ -1038,7 +1577,8 @@ template <typename Type, typename Allocator> class tree
       }
       // ...as the new root.
       else {
-        std::construct_at(node, value, position_node, position_node);
+        std::construct_at(node, value, position_node, position_node, nullptr,
+                          nullptr, nullptr);
         position_node->parent = node;
         root = node;
       }
@@ -1064,7 +1604,11 @@ template <typename Type, typename Allocator> class tree
       }
     }
 
+    measure(node);
+    order(node);
+    thread(node);
     ++node_count;
+    ++revision_count;
 
     return { node };
   }
@@ -1113,7 +1657,8 @@ template <typename Type, typename Allocator> class tree
       }
       // ...as the new root.
       else {
-        std::construct_at(node, std::move(value), position_node, position_node);
+        std::construct_at(node, std::move(value), position_node, position_node,
+                          nullptr, nullptr, nullptr);
         position_node->parent = node;
         root = node;
       }
@@ -1139,7 +1684,11 @@ template <typename Type, typename Allocator> class tree
       }
     }
 
+    measure(node);
+    order(node);
+    thread(node);
     ++node_count;
+    ++revision_count;
 
     return { node };
   }
@@ -1190,7 +1739,11 @@ template <typename Type, typename Allocator> class tree
     }
 
     root = node;
+    measure(node);
+    order(node);
+    thread(node);
     ++node_count;
+    ++revision_count;
 
     return node->data;
   }
@@ -1247,7 +1800,8 @@ template <typename Type, typename Allocator> class tree
       // ...as the new root.
       else {
         std::construct_at(node, std::forward<Arguments>(arguments)...,
-                          position_node, position_node);
+                          position_node, position_node, nullptr, nullptr,
+                          nullptr);
         position_node->parent = node;
         root = node;
       }
@@ -1273,7 +1827,11 @@ template <typename Type, typename Allocator> class tree
       }
     }
 
+    measure(node);
+    order(node);
+    thread(node);
     ++node_count;
+    ++revision_count;
 
     return { node };
   }
@@ -1301,6 +1859,7 @@ template <typename Type, typename Allocator> class tree
     internal_node_type *next{ position.node->next_ancestor_sibling() };
     cleave(position.node);
     prune(position.node);
+    ++revision_count;
 
     return { next };
   }
@@ -1329,6 +1888,7 @@ template <typename Type, typename Allocator> class tree
     internal_node_type *next{ position.node->next_ancestor_sibling() };
     cleave(position.node);
     prune(position.node);
+    ++revision_count;
 
     return { next };
   }
@@ -1477,14 +2037,19 @@ template <typename Type, typename Allocator> class tree
 
   //! @brief Isolates the specified element including its sub-tree.
   //!
-  //! @details Orphans the node from its parent and disolves its sibling
-  //! relationships. The container's size is not maintained and no longer
-  //! corresponds to the container content. Cleaving the root or last node has
-  //! the expected effects on the tree.
+  //! @details Orphans the node from its parent, disolves its sibling
+  //! relationships, and threads its pre-order predecessor past the subtree.
+  //! The container's size is not maintained and no longer corresponds to the
+  //! container content. Cleaving the root or last node has the expected
+  //! effects on the tree.
   //!
   //! @param node The pointer to the element to cleave.
+  //!
+  //! @complexity Linear in the height of the container with the thread node
+  //! policy, constant otherwise.
   constexpr void cleave(internal_node_type *node)
   {
+    unthread(node);
     if (node == root) {
       root = nullptr;
     }
@@ -1498,12 +2063,12 @@ template <typename Type, typename Allocator> class tree
     }
     if (node->left_sibling) {
       node->left_sibling->right_sibling = node->right_sibling;
-      node->left_sibling = nullptr;
     }
     if (node->right_sibling) {
       node->right_sibling->left_sibling = node->left_sibling;
-      node->right_sibling = nullptr;
     }
+    node->left_sibling = nullptr;
+    node->right_sibling = nullptr;
   }
 
   //! @brief Recursively erases the specified element including its sub-tree.
@@ -1530,7 +2095,7 @@ template <typename Type, typename Allocator> class tree
       }
 
       std::destroy_at(current);
-      node_allocator.deallocate(current, 1);
+      deallocate(current);
 
       --node_count;
     }
@@ -1559,8 +2124,242 @@ template <typename Type, typename Allocator> class tree
       }
 
       std::destroy_at(current);
-      node_allocator.deallocate(current, 1);
+      deallocate(current);
+    }
+  }
+
+  //! @brief Allocates a block of nodes.
+  //!
+  //! @details The nodes are not constructed. The block is inserted in the
+  //! blocks of the container, its storage is deallocated once all its slots
+  //! are vacant, or on release.
+  //!
+  //! @param count The number of nodes of the block.
+  //!
+  //! @return The pointer to the first node of the block.
+  //!
+  //! @exceptions Strong exception guarantees: no effect on exception. Same
+  //! exceptions as the allocator `Allocator::allocate()`.
+  internal_node_type *allocate_block(size_type count)
+  {
+    internal_block_allocator_type block_allocator{ node_allocator };
+    internal_block_type *block = block_allocator.allocate(1);
+    internal_node_type *nodes = nullptr;
+    try {
+      nodes = node_allocator.allocate(count);
+    } catch (...) {
+      block_allocator.deallocate(block, 1);
+      throw;
     }
+    std::construct_at(block, nodes, count);
+    internal_block_type **link = &blocks;
+    while (internal_block_type *parent = *link) {
+      block->parent = parent;
+      link = std::less<>{}(nodes, parent->nodes) ? &parent->left
+                                                 : &parent->right;
+    }
+    *link = block;
+    splay(block);
+
+    return nodes;
+  }
+
+  //! @brief Rotates a block above its parent block.
+  //!
+  //! @param block The pointer to the block to rotate, with a parent.
+  //!
+  //! @complexity Constant.
+  constexpr void rotate(internal_block_type *block) noexcept
+  {
+    internal_block_type *parent = block->parent;
+    internal_block_type *grandparent = parent->parent;
+    if (parent->left == block) {
+      parent->left = block->right;
+      if (block->right) {
+        block->right->parent = parent;
+      }
+      block->right = parent;
+    } else {
+      parent->right = block->left;
+      if (block->left) {
+        block->left->parent = parent;
+      }
+      block->left = parent;
+    }
+    parent->parent = block;
+    block->parent = grandparent;
+    if (grandparent) {
+      if (grandparent->left == parent) {
+        grandparent->left = block;
+      } else {
+        grandparent->right = block;
+      }
+    }
+  }
+
+  //! @brief Splays a block to the root of its blocks.
+  //!
+  //! @details The recently used blocks stay close to the root, the nodes of a
+  //! block being usually destroyed in a row.
+  //!
+  //! @param block The pointer to the block to splay.
+  //!
+  //! @complexity Amortized logarithmic in the number of blocks.
+  constexpr void splay(internal_block_type *block) noexcept
+  {
+    while (internal_block_type *parent = block->parent) {
+      if (const internal_block_type *grandparent = parent->parent) {
+        if ((grandparent->left == parent) == (parent->left == block)) {
+          rotate(parent);
+        } else {
+          rotate(block);
+        }
+      }
+      rotate(block);
+    }
+    blocks = block;
+  }
+
+  //! @brief Finds the block of a node.
+  //!
+  //! @details The block found, or the last block searched, is splayed to the
+  //! root of the blocks.
+  //!
+  //! @param node The pointer to the node to find.
+  //!
+  //! @return The pointer to the block of the node; or `nullptr` if the node
+  //! is not in a block.
+  //!
+  //! @complexity Amortized logarithmic in the number of blocks.
+  constexpr internal_block_type *lookup(const internal_node_type *node) noexcept
+  {
+    internal_block_type *searched = nullptr;
+    for (internal_block_type *block = blocks; block;) {
+      searched = block;
+      if (std::less<>{}(node, block->nodes)) {
+        block = block->left;
+      } else if (!std::less<>{}(node, block->nodes + block->count)) {
+        block = block->right;
+      } else {
+        splay(block);
+        return block;
+      }
+    }
+    if (searched) {
+      splay(searched);
+    }
+
+    return nullptr;
+  }
+
+  //! @brief Vacates slots of a block.
+  //!
+  //! @details The block is removed from the blocks and its storage is
+  //! deallocated once all its slots are vacant.
+  //!
+  //! @param block The pointer to the block.
+  //! @param count The number of slots vacated.
+  //!
+  //! @complexity Amortized logarithmic in the number of blocks.
+  constexpr void vacate(internal_block_type *block, size_type count)
+  {
+    vacant_count += count;
+    block->vacant += count;
+    if (block->vacant != block->count) {
+      return;
+    }
+
+    // Join the blocks around the root block to remove...
+    splay(block);
+    if (internal_block_type *left = block->left) {
+      // ...under the greatest block at its left...
+      internal_block_type *greatest = left;
+      while (greatest->right) {
+        greatest = greatest->right;
+      }
+      left->parent = nullptr;
+      splay(greatest);
+      greatest->right = block->right;
+      if (block->right) {
+        block->right->parent = greatest;
+      }
+    }
+    // ...or lift the blocks at its right.
+    else {
+      blocks = block->right;
+      if (blocks) {
+        blocks->parent = nullptr;
+      }
+    }
+
+    internal_block_allocator_type block_allocator{ node_allocator };
+    vacant_count -= block->count;
+    node_allocator.deallocate(block->nodes, block->count);
+    std::destroy_at(block);
+    block_allocator.deallocate(block, 1);
+  }
+
+  //! @brief Deallocates the storage of a destroyed node.
+  //!
+  //! @details The slot of a node of a block becomes vacant, its storage being
+  //! deallocated with its block.
+  //!
+  //! @param node The pointer to the node to deallocate.
+  //!
+  //! @complexity Amortized logarithmic in the number of blocks.
+  constexpr void deallocate(internal_node_type *node)
+  {
+    if (internal_block_type *block = lookup(node)) {
+      vacate(block, 1);
+    } else {
+      node_allocator.deallocate(node, 1);
+    }
+  }
+
+  //! @brief Deallocates the blocks of nodes.
+  //!
+  //! @details The nodes of the blocks must be destroyed. The blocks are
+  //! flattened by rotations as they are deallocated.
+  //!
+  //! @complexity Linear in the number of blocks.
+  constexpr void release()
+  {
+    internal_block_allocator_type block_allocator{ node_allocator };
+    while (internal_block_type *block = blocks) {
+      if (internal_block_type *left = block->left) {
+        block->left = left->right;
+        left->right = block;
+        blocks = left;
+      } else {
+        blocks = block->right;
+        node_allocator.deallocate(block->nodes, block->count);
+        std::destroy_at(block);
+        block_allocator.deallocate(block, 1);
+      }
+    }
+    vacant_count = 0;
+  }
+
+  //! @brief Checks whether the nodes are packed in the blocks.
+  //!
+  //! @details The nodes are packed when every node is in a block and every
+  //! slot of the blocks holds a node, as after a sequenced copy.
+  //!
+  //! @return `true` if the nodes are packed, `false` otherwise.
+  //!
+  //! @complexity Linear in the number of blocks.
+  [[nodiscard]] constexpr bool packed() const noexcept
+  {
+    if (vacant_count || !blocks) {
+      return false;
+    }
+    size_type capacity = 0;
+    for (const internal_block_type *block = blocks->first(); block;
+         block = block->next()) {
+      capacity += block->count;
+    }
+
+    return capacity == node_count;
   }
 
   //! @brief Inserts a constructed in-place element into the container after the
@@ -1637,7 +2436,11 @@ template <typename Type, typename Allocator> class tree
       }
     }
 
+    measure(child);
+    order(child);
+    thread(child);
     ++node_count;
+    ++revision_count;
 
     return child;
   }
@@ -1668,78 +2471,447 @@ template <typename Type, typename Allocator> class tree
     internal_node_type *node = node_allocator.allocate(1);
 
     // Insert the new node and prepare it to be the new root...
-    std::construct_at(node, std::forward<Arguments>(arguments)..., root, root);
+    std::construct_at(node, std::forward<Arguments>(arguments)..., root, root,
+                      nullptr, nullptr, nullptr);
 
     // ... by displacing the previous root.
     if (root) {
       root->parent = node;
     }
     root = node;
+    measure(node);
+    order(node);
+    thread(node);
 
     ++node_count;
+    ++revision_count;
+  }
+
+  //! @brief Caches the level of a node newly linked in the container.
+  //!
+  //! @details A new child is one level below its parent, a new root is one
+  //! level above the previous root. The level is cached with the level node
+  //! policy only.
+  //!
+  //! @param node The pointer to the element to level, either a leaf, the new
+  //! root of the previous root, or the sole root.
+  //!
+  //! @complexity Constant.
+  constexpr void measure(internal_node_type *node) noexcept
+  {
+    if constexpr (NodePolicy::level) {
+      if (node->parent) {
+        node->level = node->parent->level + 1;
+      } else if (node->first_child) {
+        node->level = node->first_child->level - 1;
+      }
+    }
+  }
+
+  //! @brief Labels a node newly linked in the container.
+  //!
+  //! @details The entry and exit labels of the node are chosen between the
+  //! labels of the neighbor tokens of the tour. A new leaf splits the gap
+  //! between its neighbors, a new root is labeled before and after the tour. A
+  //! gap too narrow for the labels is widened by relabeling. The node is
+  //! labeled with the order node policy only.
+  //!
+  //! @param node The pointer to the element to label, either a leaf, the new
+  //! root of the previous root, or the sole root.
+  //!
+  //! @complexity Amortized logarithmic in the size of the container.
+  constexpr void order(internal_node_type *node) noexcept
+  {
+    if constexpr (NodePolicy::order) {
+      // Label the node...
+      // ...as a leaf between the neighbor tokens...
+      if (node->parent) {
+        const internal_token_type previous{
+          node->left_sibling ? node->left_sibling : node->parent,
+          node->left_sibling != nullptr
+        };
+        const internal_token_type next{
+          node->right_sibling ? node->right_sibling : node->parent,
+          node->right_sibling == nullptr
+        };
+        const std::uint64_t low = previous.label();
+        const std::uint64_t gap = next.label() - low;
+        if (gap >= 3) {
+          node->entry_label = low + gap / 3;
+          node->exit_label = low + gap / 3 * 2;
+        } else {
+          node->entry_label = low;
+          node->exit_label = low;
+          relabel({ node, false });
+        }
+      }
+      // ...as the new root before and after the previous root...
+      else if (node->first_child) {
+        const std::uint64_t high = node->first_child->entry_label;
+        if (high >= 2) {
+          node->entry_label = high / 2;
+        } else {
+          node->entry_label = 0;
+          relabel({ node, false });
+        }
+        const std::uint64_t low = node->first_child->exit_label;
+        const std::uint64_t gap = label_limit - low;
+        if (gap >= 2) {
+          node->exit_label = low + gap / 2;
+        } else {
+          node->exit_label = low;
+          relabel({ node, true });
+        }
+      }
+      // ...as the sole root.
+      else {
+        node->entry_label = label_limit / 3;
+        node->exit_label = label_limit / 3 * 2;
+      }
+    }
+  }
+
+  //! @brief Threads a node newly linked in the container.
+  //!
+  //! @details A new leaf is threaded right after its pre-order predecessor:
+  //! the deepest last descendant of its left sibling if any, or its parent. A
+  //! new root precedes the previous root.
+  //!
+  //! @param node The pointer to the element to thread, either a leaf, the new
+  //! root of the previous root, or the sole root.
+  //!
+  //! @complexity Linear in the height of the container with the thread node
+  //! policy, constant otherwise.
+  constexpr void thread(internal_node_type *node) noexcept
+  {
+    if constexpr (NodePolicy::thread) {
+      // Thread the node...
+      // ...as a leaf after its predecessor...
+      if (node->parent) {
+        internal_node_type *previous =
+            node->left_sibling ? node->left_sibling->last_descendant()
+                               : node->parent;
+        node->successor = previous->successor;
+        previous->successor = node;
+      }
+      // ...or as the root before the previous root, if any.
+      else {
+        node->successor = node->first_child;
+      }
+    }
+  }
+
+  //! @brief Unthreads a node and its subtree still linked in the container.
+  //!
+  //! @details The pre-order predecessor of the node is threaded to the
+  //! successor of the last node of the subtree, bypassing the subtree.
+  //!
+  //! @param node The pointer to the element to unthread.
+  //!
+  //! @complexity Linear in the height of the container with the thread node
+  //! policy, constant otherwise.
+  constexpr void unthread(internal_node_type *node) noexcept
+  {
+    if constexpr (NodePolicy::thread) {
+      if (node->parent) {
+        internal_node_type *previous =
+            node->left_sibling ? node->left_sibling->last_descendant()
+                               : node->parent;
+        previous->successor = node->last_descendant()->successor;
+      }
+    }
+  }
+
+  //! @brief Relabels the tokens around a token evenly.
+  //!
+  //! @details Order-maintenance relabeling of the smallest enclosing range of
+  //! labels sparse enough. The range of `2^i` labels surrounding the label of
+  //! the token is widened until it holds at most `1.5^i` tokens and leaves a
+  //! gap of at least four labels between its tokens. The tokens of the range
+  //! are then labeled evenly. The labels along the tour are non-decreasing
+  //! before the relabeling, and increasing afterwards.
+  //!
+  //! @param token The token whose label collides with its neighbors.
+  //!
+  //! @complexity Amortized logarithmic in the size of the container.
+  constexpr void relabel(internal_token_type token) noexcept
+  {
+    const std::uint64_t label = token.label();
+    internal_token_type first = token;
+    internal_token_type last = token;
+    std::uint64_t count = 1;
+    std::uint64_t base = label;
+    std::uint64_t width = 1;
+    double capacity = 1.;
+
+    // Widen the range until it is sparse enough...
+    for (int bits = 1; bits <= label_bits; ++bits) {
+      width <<= 1;
+      base = label & ~(width - 1);
+      capacity *= 1.5;
+
+      // ...counting the tokens of the range.
+      for (internal_token_type previous = first.previous();
+           previous && previous.label() >= base;
+           previous = previous.previous()) {
+        first = previous;
+        ++count;
+      }
+      for (internal_token_type next = last.next();
+           next && next.label() - base < width; next = next.next()) {
+        last = next;
+        ++count;
+      }
+
+      if (count * 4 <= width && static_cast<double>(count) <= capacity) {
+        break;
+      }
+    }
+
+    // Spread the tokens evenly in the range.
+    const std::uint64_t step = width / count;
+    for (std::uint64_t next_label = base + step / 2;; next_label += step) {
+      first.label() = next_label;
+      if (first.node == last.node && first.exit == last.exit) {
+        break;
+      }
+      first = first.next();
+    }
+  }
+
+  //! @brief Copies the other container.
+  //!
+  //! @details The packed nodes of trivially copyable elements are copied in
+  //! bulk, block by block, and their links are rebased to the copied blocks.
+  //! The nodes are otherwise copied one by one in pre-order. The copy is
+  //! packed.
+  //!
+  //! @param other The other container to copy.
+  //!
+  //! @return The root of the copy.
+  //!
+  //! @complexity Linear in the size of the other container.
+  internal_node_type *copy(const tree &other)
+  {
+    if constexpr (std::is_trivially_copyable_v<internal_node_type>) {
+      if (other.packed()) {
+        try {
+          return clone(other);
+        } catch (const std::bad_alloc &) {
+          // The allocator cannot provide the blocks of the other container.
+          release();
+        }
+      }
+    }
+
+    return copy(other.root, other.node_count);
+  }
+
+  //! @brief Clones the packed nodes of the other container.
+  //!
+  //! @details Every block of the other container is copied in bulk to a block
+  //! of this container in address order, by tiles rebased while in cache. The
+  //! links into the same block are rebased by an offset, the other links by a
+  //! search of their block. A single block clone rebases without branches.
+  //!
+  //! @param other The packed other container to clone.
+  //!
+  //! @return The root of the clone.
+  //!
+  //! @complexity Linear in the size of the other container.
+  internal_node_type *clone(const tree &other)
+  {
+    struct internal_mapping_type {
+      const internal_node_type *first;
+      const internal_node_type *last;
+      internal_node_type *nodes;
+    };
+
+    std::vector<internal_mapping_type> mappings;
+    for (const internal_block_type *block = other.blocks->first(); block;
+         block = block->next()) {
+      mappings.push_back({ block->nodes, block->nodes + block->count,
+                           allocate_block(block->count) });
+    }
+
+    const auto rebase = [&mappings](internal_node_type *node) {
+      const auto mapping{ std::prev(std::ranges::upper_bound(
+          mappings, node, std::less<>{}, &internal_mapping_type::first)) };
+      return mapping->nodes + (node - mapping->first);
+    };
+
+    for (const internal_mapping_type &mapping : mappings) {
+      const std::ptrdiff_t count{ mapping.last - mapping.first };
+      const auto first{ reinterpret_cast<std::uintptr_t>(mapping.first) };
+      const auto extent{ static_cast<std::uintptr_t>(count) *
+                         sizeof(internal_node_type) };
+      const auto offset{ reinterpret_cast<std::uintptr_t>(mapping.nodes) -
+                         first };
+      // A single block holds all the links: they are rebased without branches.
+      const auto offset_shift = [first, extent,
+                                 offset](internal_node_type *&link) {
+        const auto address{ reinterpret_cast<std::uintptr_t>(link) };
+        link = reinterpret_cast<internal_node_type *>(
+            address + (address - first < extent ? offset : 0));
+      };
+      const auto search_shift = [&rebase, first, extent,
+                                 offset](internal_node_type *&link) {
+        const auto address{ reinterpret_cast<std::uintptr_t>(link) };
+        if (address - first < extent) {
+          link = reinterpret_cast<internal_node_type *>(address + offset);
+        } else if (link) {
+          link = rebase(link);
+        }
+      };
+      const auto shift_all = [](internal_node_type *tile, std::ptrdiff_t size,
+                                const auto &shift) {
+        for (internal_node_type *node = tile; node != tile + size; ++node) {
+          shift(node->first_child);
+          shift(node->last_child);
+          shift(node->left_sibling);
+          shift(node->right_sibling);
+          shift(node->parent);
+          if constexpr (NodePolicy::thread) {
+            shift(node->successor);
+          }
+        }
+      };
+
+      for (std::ptrdiff_t position = 0; position < count; position += 256) {
+        internal_node_type *tile = mapping.nodes + position;
+        const std::ptrdiff_t size{ std::min<std::ptrdiff_t>(
+            256, count - position) };
+        std::memcpy(static_cast<void *>(tile), mapping.first + position,
+                    static_cast<std::size_t>(size) *
+                        sizeof(internal_node_type));
+        if (mappings.size() == 1) {
+          shift_all(tile, size, offset_shift);
+        } else {
+          shift_all(tile, size, search_shift);
+        }
+      }
+    }
+
+    return rebase(other.root);
   }
 
-  //! @brief Copies the node, its subtrees, and right siblings recursively.
+  //! @brief Copies the node and its subtrees.
   //!
   //! @details Constructs a new node from the `other_node` element value.
   //! Attaches the newly created child to its parent, if any. Attaches the newly
-  //! created right sibling to its left sibling, if any.
+  //! created right sibling to its left sibling, if any. The nodes are
+  //! allocated in a few large blocks laid out in pre-order, of halving sizes
+  //! if the allocator cannot provide a block at once. The first exception
+  //! thrown by a copy or an allocation destroys the copied elements and is
+  //! rethrown.
   //!
   //! @param other_node The other tree node to copy.
+  //! @param count The number of nodes of the subtree of the other node.
   //!
   //! @complexity Linear in the size of the number of nodes copied.
-  internal_node_type *copy(internal_node_type *other_node)
+  internal_node_type *copy(internal_node_type *other_node, size_type count)
   {
     // If there is another node to copy...
     if (other_node) {
-      // ...allocate and in-place construct the first node with this container's
+      // ...allocate the nodes in pre-order in as few blocks as the allocator
+      // permits...
+      internal_node_type *next = nullptr;
+      internal_node_type *end = nullptr;
+      const auto take = [this, &next, &end, &count]() {
+        if (next == end) {
+          for (size_type size = std::min(count, block_size);;
+               size = size / 2 + size % 2) {
+            try {
+              next = allocate_block(size);
+              end = next + size;
+              count -= size;
+              break;
+            } catch (const std::bad_alloc &) {
+              if (size == 1) {
+                throw;
+              }
+            }
+          }
+        }
+
+        return next++;
+      };
+
+      // ...and in-place construct the first node with this container's
       // allocator and the other node data value...
-      internal_node_type *first = node_allocator.allocate(1);
-      std::construct_at(first, other_node->data, nullptr, nullptr, nullptr,
-                        nullptr, nullptr);
+      internal_node_type *first = nullptr;
+      try {
+        first = take();
+        std::construct_at(first, other_node->data);
+        first->entry_label = other_node->entry_label;
+        first->exit_label = other_node->exit_label;
+      } catch (...) {
+        release();
+        throw;
+      }
 
       // ...walk the other tree to copy and track the tree copied...
       internal_node_type *next_other = other_node->first_child;
       internal_node_type *next_parent = first;
       internal_node_type *next_left_sibling = nullptr;
+      [[maybe_unused]] internal_node_type *previous = first;
+
+      try {
+        // ...for every node to copy...
+        while (next_other) {
+          // ...in-place construct a node with the other node data value, and
+          // any left sibling or parent pointers...
+          internal_node_type *node = take();
+          std::construct_at(node, next_other->data, nullptr, nullptr,
+                            next_left_sibling, nullptr, next_parent);
+          measure(node);
+          node->entry_label = next_other->entry_label;
+          node->exit_label = next_other->exit_label;
+
+          // ...reference any parent, left sibling, and pre-order predecessor
+          // to the new node...
+          if constexpr (NodePolicy::thread) {
+            previous->successor = node;
+            previous = node;
+          }
+          next_parent->last_child = node;
+          if (next_left_sibling) {
+            next_left_sibling->right_sibling = node;
+          } else {
+            next_parent->first_child = node;
+          }
 
-      // ...for every node to copy...
-      while (next_other) {
-        // ...allocate and in-place construct a node with this container's
-        // allocator, the other node data value, and any left sibling or parent
-        // pointers...
-        internal_node_type *node = node_allocator.allocate(1);
-        std::construct_at(node, next_other->data, nullptr, nullptr,
-                          next_left_sibling, nullptr, next_parent);
-
-        // ...reference any parent and left sibling to the new node...
-        next_parent->last_child = node;
-        if (next_left_sibling) {
-          next_left_sibling->right_sibling = node;
-        } else {
-          next_parent->first_child = node;
-        }
-
-        // ...walk to the next other tree node to copy and walk and track the
-        // copied tree alongside...
-        next_parent = node;
-        next_left_sibling = nullptr;
-        if (next_other->first_child) {
-          next_other = next_other->first_child;
-        } else {
-          // ...going back to the next ancestor sibling and tracking as
-          // necessary.
-          while (next_other) {
-            if (next_other->right_sibling) {
-              next_other = next_other->right_sibling;
-              break;
+          // ...walk to the next other tree node to copy and walk and track the
+          // copied tree alongside...
+          if (next_other->first_child) {
+            next_other = next_other->first_child;
+            next_parent = node;
+            next_left_sibling = nullptr;
+          } else {
+            // ...going back to the next ancestor sibling and tracking as
+            // necessary, the copied node being the copy of the other node.
+            internal_node_type *copied = node;
+            while (true) {
+              if (next_other->right_sibling) {
+                next_other = next_other->right_sibling;
+                next_parent = copied->parent;
+                next_left_sibling = copied;
+                break;
+              }
+              next_other = next_other->parent;
+              copied = copied->parent;
+              if (next_other == other_node) {
+                next_other = nullptr;
+                break;
+              }
             }
-            next_other = next_other->parent;
-            next_parent = next_parent->parent;
-            next_left_sibling = next_parent->last_child;
           }
         }
-      };
+      } catch (...) {
+        axe(first);
+        release();
+        throw;
+      }
 
       return first;
     }
@@ -1747,6 +2919,128 @@ template <typename Type, typename Allocator> class tree
     return nullptr;
   }
 
+  //! @brief Copies the node and its subtrees in parallel.
+  //!
+  //! @details Until a copied node is visited, its first child link holds its
+  //! other node. Visiting a copied node copies the children of its other node
+  //! and threads the copied node, the copies of its ancestors and their
+  //! siblings being complete. The team constructs the nodes in slabs of a
+  //! fraction of the size of the copy, every thread in its own slab. The slabs
+  //! are carved in turn from the shared blocks of the copy, as large as for a
+  //! sequenced copy.
+  //!
+  //! @param policy The parallel execution policy.
+  //! @param other_node The other tree node to copy.
+  //! @param count The number of nodes of the subtree of the other node.
+  //!
+  //! @complexity Linear in the size of the number of nodes copied.
+  internal_node_type *copy(const parallel_policy &policy,
+                           internal_node_type *other_node, size_type count)
+  {
+    if (!other_node) {
+      return nullptr;
+    }
+
+    internal_node_type *first = node_allocator.allocate(1);
+    try {
+      std::construct_at(first, other_node->data, other_node);
+      first->entry_label = other_node->entry_label;
+      first->exit_label = other_node->exit_label;
+    } catch (...) {
+      node_allocator.deallocate(first, 1);
+      throw;
+    }
+
+    struct alignas(64) internal_slab_type {
+      internal_node_type *next = nullptr;
+      internal_node_type *end = nullptr;
+    };
+
+    std::vector<internal_slab_type> slabs(internal_concurrency(policy));
+    internal_slab_type block;
+    std::mutex mutex;
+    size_type remaining = count - 1;
+    const size_type grain = std::clamp<size_type>(
+        remaining / (slabs.size() * 8), 64, block_size);
+
+    try {
+      internal_parallel_visit(
+          policy, first, [&](std::size_t index, internal_node_type *node) {
+            internal_slab_type &slab = slabs[index];
+            const internal_node_type *other_parent =
+                std::exchange(node->first_child, nullptr);
+            for (internal_node_type *other = other_parent->first_child; other;
+                 other = other->right_sibling) {
+              if (slab.next == slab.end) {
+                const std::lock_guard lock{ mutex };
+                if (block.next == block.end) {
+                  const size_type size =
+                      remaining ? std::min(block_size, remaining) : grain;
+                  remaining -= std::min(size, remaining);
+                  block.next = allocate_block(size);
+                  block.end = block.next + size;
+                }
+                const auto available{ static_cast<size_type>(block.end -
+                                                             block.next) };
+                slab.next = block.next;
+                slab.end = slab.next + std::min(grain, available);
+                block.next = slab.end;
+              }
+              internal_node_type *child = slab.next;
+              std::construct_at(child, other->data, other, nullptr,
+                                node->last_child, nullptr, node);
+              measure(child);
+              child->entry_label = other->entry_label;
+              child->exit_label = other->exit_label;
+              ++slab.next;
+              if (node->last_child) {
+                node->last_child->right_sibling = child;
+              } else {
+                node->first_child = child;
+              }
+              node->last_child = child;
+            }
+            if constexpr (NodePolicy::thread) {
+              node->successor = node->first_child
+                                    ? node->first_child
+                                    : node->next_ancestor_sibling();
+            }
+
+            return internal_visit_type::descend;
+          });
+    } catch (...) {
+      axe(first);
+      release();
+      throw;
+    }
+    slabs.push_back(block);
+    for (const internal_slab_type &slab : slabs) {
+      if (slab.next != slab.end) {
+        vacate(lookup(slab.next), static_cast<size_type>(slab.end - slab.next));
+      }
+    }
+
+    return first;
+  }
+
+  //! @}
+
+  //! @name Private Member Constants
+  //! @{
+
+  //! @brief The number of bits of the order-maintenance labels.
+  static constexpr int label_bits = 62;
+
+  //! @brief The upper bound of the order-maintenance labels, excluded.
+  static constexpr std::uint64_t label_limit = std::uint64_t{ 1 } << label_bits;
+
+  //! @brief The maximum number of nodes of a block.
+  //!
+  //! @details A bounded block is recycled by the allocator, where a block of
+  //! the size of a large container would be a fresh mapping faulted in on
+  //! every copy.
+  static constexpr size_type block_size = size_type{ 1 } << 14;
+
   //! @}
 
   //! @name Private Member Variables
@@ -1755,12 +3049,22 @@ template <typename Type, typename Allocator> class tree
   //! @brief The rebound allocator for the container's memory nodes.
   internal_node_allocator_type node_allocator{};
 
+  //! @brief The root of the container's blocks of nodes, the most recently
+  //! used block.
+  internal_block_type *blocks = nullptr;
+
+  //! @brief The number of slots of the blocks without a node.
+  size_type vacant_count = 0;
+
   //! @brief The container's root node.
   internal_node_type *root = nullptr;
 
   //! @brief The total number of elements as nodes in the container.
   size_type node_count = 0;
 
+  //! @brief The structural revision of the container.
+  size_type revision_count = 0;
+
   //! @}
 };
 
@@ -1780,10 +3084,10 @@ template <typename Type, typename Allocator> class tree
 //!
 //! @complexity Linear in the size of the container. Constant if the size of the
 //! compared containers are different, linear otherwise.
-template <typename Type, typename Allocator>
+template <typename Type, typename Allocator, typename NodePolicy>
 [[nodiscard]] constexpr bool
-operator==(const fcarouge::tree<Type, Allocator> &lhs,
-           const fcarouge::tree<Type, Allocator> &rhs)
+operator==(const fcarouge::tree<Type, Allocator, NodePolicy> &lhs,
+           const fcarouge::tree<Type, Allocator, NodePolicy> &rhs)
 {
   return std::addressof(lhs) == std::addressof(rhs) ||
          (lhs.size() == rhs.size() &&
@@ -1821,10 +3125,10 @@ operator==(const fcarouge::tree<Type, Allocator> &lhs,
 //! elements in `lhs` and `rhs` are unordered; `std::strong::equal` otherwise.
 //!
 //! @complexity Linear in the size of the container.
-template <typename Type, typename Allocator>
+template <typename Type, typename Allocator, typename NodePolicy>
 [[nodiscard]] constexpr auto
-operator<=>(const fcarouge::tree<Type, Allocator> &lhs,
-            const fcarouge::tree<Type, Allocator> &rhs);
+operator<=>(const fcarouge::tree<Type, Allocator, NodePolicy> &lhs,
+            const fcarouge::tree<Type, Allocator, NodePolicy> &rhs);
 
 //! @brief Inserts a human-interpretable representation of a container into a
 //! character stream.
@@ -1844,15 +3148,18 @@ operator<=>(const fcarouge::tree<Type, Allocator> &lhs,
 //! elements.
 //! @tparam Allocator The type template parameter of the allocator for the nodes
 //! of the tree elements.
+//! @tparam NodePolicy The type template parameter of the node policy of the
+//! tree.
 //!
 //! @param output_stream The character stream to write to.
 //! @param tree The tree to be written.
 //!
 //! @return The character stream `output_stream` that was operated on.
-template <typename Char, typename Traits, typename Type, typename Allocator>
+template <typename Char, typename Traits, typename Type, typename Allocator,
+          typename NodePolicy>
 std::basic_ostream<Char, Traits> &
 operator<<(std::basic_ostream<Char, Traits> &output_stream,
-           const fcarouge::tree<Type, Allocator> &tree)
+           const fcarouge::tree<Type, Allocator, NodePolicy> &tree)
 {
   // If there is a root...
   if (const auto *root = tree.begin().node) {
@@ -35,8 +35,43 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #ifndef FCAROUGE_TREE_ALGORITHM_HPP
 #define FCAROUGE_TREE_ALGORITHM_HPP
 
+#include <algorithm>
+// std::min
+
+#include <array>
+// std::array
+
+#include <atomic>
+// std::atomic std::memory_order_acq_rel std::memory_order_acquire
+
+#include <cstddef>
+// std::size_t
+
+#include <functional>
+// std::identity std::invoke std::plus
+
 #include <iterator>
-// std::iterator_traits
+// std::iterator_traits std::random_access_iterator
+
+#include <optional>
+// std::optional
+
+#include <ranges>
+// std::ranges::random_access_range std::ranges::range_value_t
+// std::ranges::size std::ranges::subrange
+
+#include <type_traits>
+// std::is_same_v std::remove_pointer_t
+
+#include <utility>
+// std::as_const std::move
+
+#include <vector>
+// std::vector
+
+#include "tree_execution.hpp"
+
+#include "tree_iterator.hpp"
 
 #include "tree_iterator_fwd.hpp"
 
@@ -76,6 +111,964 @@ namespace fcarouge
   return depth;
 }
 
+//! @brief Depth of the path from the root, top element to the iterated node.
+//!
+//! @details Returns the depth tracked by the depth-aware iterator while it
+//! traversed the container. The root node has depth of `0`, its children have
+//! depth `1`, etc... The behavior is undefined if `*this` is the end iterator.
+//!
+//! @tparam Iterator The underlying tree member iterator type template
+//! parameter of the depth-aware iterator.
+//!
+//! @param position The depth-aware iterator to the element for which to obtain
+//! the depth.
+//!
+//! @return Current depth of the iterator, as the iterator `difference_type`.
+//!
+//! @complexity Constant.
+template <typename Iterator>
+[[nodiscard]] constexpr auto
+depth(const depth_aware_iterator_type<Iterator> &position)
+{
+  return position.level;
+}
+
+//! @brief Depth of the path from the root, top element to the iterated node.
+//!
+//! @details Returns the depth from the level cached in every node of the
+//! container with the level node policy, or walks the ancestors otherwise. The
+//! root node has depth of `0`, its children have depth `1`, etc... The behavior
+//! is undefined if `*this` is the end iterator or if the iterator does not
+//! belong to the container.
+//!
+//! @tparam Type The type template parameter of the contained data in the tree
+//! elements.
+//! @tparam Allocator The type template parameter of the allocator for the nodes
+//! of the tree elements.
+//! @tparam NodePolicy The type template parameter of the node policy of the
+//! tree.
+//!
+//! @param container The container of the iterated element.
+//! @param position The iterator to the element for which to obtain the depth.
+//!
+//! @return Current depth of the iterator, as the iterator `difference_type`.
+//!
+//! @complexity Constant with the level node policy, linear in depth
+//! otherwise.
+template <typename Type, typename Allocator, typename NodePolicy>
+[[nodiscard]] constexpr auto
+depth([[maybe_unused]] const tree<Type, Allocator, NodePolicy> &container,
+      TreeIterator auto position)
+{
+  if constexpr (NodePolicy::level) {
+    return position.node->level - container.begin().node->level;
+  } else {
+    return depth(position);
+  }
+}
+
+//! @brief Checks whether an element is an ancestor of another element.
+//!
+//! @details Compares the order-maintenance labels of the entries and exits of
+//! the nodes maintained by a container of the order node policy, or walks the
+//! ancestors of the presumed descendant otherwise. An element is an ancestor
+//! of itself. The behavior is undefined if either iterator is not
+//! dereferenceable or if the iterators belong to different containers.
+//!
+//! @param ancestor The iterator to the presumed ancestor element.
+//! @param descendant The iterator to the presumed descendant element.
+//!
+//! @return `true` if the first element is an ancestor of the second element,
+//! `false` otherwise.
+//!
+//! @complexity Constant with the order node policy, linear in the depth of the
+//! presumed descendant otherwise.
+[[nodiscard]] constexpr bool is_ancestor(TreeIterator auto ancestor,
+                                         TreeIterator auto descendant)
+{
+  return ancestor.node->encloses(descendant.node);
+}
+
+//! @brief Checks whether an element precedes another element in pre-order.
+//!
+//! @details Compares the order-maintenance labels of the entries of the nodes
+//! maintained by a container of the order node policy, or walks the ancestors
+//! and siblings of the nodes otherwise. The comparison is a strict weak
+//! ordering of the elements of a container. The behavior is undefined if
+//! either iterator is not dereferenceable or if the iterators belong to
+//! different containers. The labels order the elements without ranking them:
+//! the distance between two elements remains linear.
+//!
+//! @param lhs The iterator to the first element.
+//! @param rhs The iterator to the second element.
+//!
+//! @return `true` if the first element is visited before the second element
+//! in a pre-order depth-first traversal, `false` otherwise.
+//!
+//! @complexity Constant with the order node policy, linear in the height of
+//! the container and in the number of children of the lowest common ancestor
+//! otherwise.
+[[nodiscard]] constexpr bool precedes(TreeIterator auto lhs,
+                                      TreeIterator auto rhs)
+{
+  return lhs.node->precedes(rhs.node);
+}
+
+//! @}
+
+//! @name Searching Operations
+//! @{
+
+//! @brief Searches many elements in many containers, interleaved.
+//!
+//! @details Every lookup searches the first element equal to its value in
+//! pre-order, from its starting position to the end of its container. Up to
+//! `Width` lookups are in flight at once in an asynchronous memory access
+//! chaining fashion: every lookup advances by one element in turn and
+//! prefetches its next element, so that the cache miss of one lookup is
+//! overlapped with the progress of the others. A completed lookup makes room
+//! for the next pending lookup. The results are written in the order of the
+//! lookups, each one the iterator to the found element, or the ending
+//! iterator.
+//!
+//! @tparam Width The maximum number of lookups interleaved.
+//! @tparam Positions The random access range type of the starting positions.
+//! @tparam Values The random access range type of the searched values.
+//! @tparam Output The random access iterator type of the results.
+//!
+//! @param positions The container iterators from which to start every lookup,
+//! for example the beginning iterators of many containers.
+//! @param values The values to search, one per lookup.
+//! @param results The beginning of the destination range of the results.
+//!
+//! @return Iterator past the last result written.
+//!
+//! @complexity Linear in the total number of elements visited by the
+//! lookups.
+template <std::size_t Width = 16, std::ranges::random_access_range Positions,
+          std::ranges::random_access_range Values,
+          std::random_access_iterator Output>
+  requires TreeMemberIterator<std::ranges::range_value_t<Positions>>
+constexpr Output find_many(Positions &&positions, Values &&values,
+                           Output results)
+{
+  static_assert(Width > 0, "At least one lookup must be in flight.");
+
+  using iterator_type = std::ranges::range_value_t<Positions>;
+  using internal_node_type =
+      std::remove_pointer_t<decltype(iterator_type::node)>;
+  using prefetcher_type =
+      depth_first_pre_order_prefetch_iterator_type<iterator_type>;
+
+  struct internal_lookup_type {
+    internal_node_type *node = nullptr;
+    std::size_t index = 0;
+  };
+
+  const std::size_t count{ std::min<std::size_t>(
+      std::ranges::size(positions), std::ranges::size(values)) };
+  std::array<internal_lookup_type, Width> lookups{};
+  std::size_t pending = 0;
+  std::size_t active = 0;
+
+  // Start the first lookups...
+  for (; active < Width && pending < count; ++active, ++pending) {
+    lookups[active] = { positions[pending].node, pending };
+    prefetcher_type::prefetch(lookups[active].node);
+  }
+
+  // ...and advance every active lookup in turn...
+  while (active) {
+    for (std::size_t slot = 0; slot < active;) {
+      internal_lookup_type &lookup = lookups[slot];
+      // ...while its element is neither the end nor found...
+      if (lookup.node && !(lookup.node->data == values[lookup.index])) {
+        lookup.node = lookup.node->next();
+        prefetcher_type::prefetch(lookup.node);
+        ++slot;
+        continue;
+      }
+
+      // ...otherwise record the result and replace the lookup by the next
+      // pending one, or by the last active one.
+      results[lookup.index] = iterator_type{ lookup.node };
+      if (pending < count) {
+        lookup = { positions[pending].node, pending };
+        prefetcher_type::prefetch(lookup.node);
+        ++pending;
+        ++slot;
+      } else {
+        lookup = lookups[--active];
+      }
+    }
+  }
+
+  return results + count;
+}
+
+//! @brief The match of a search among the elements satisfying a predicate.
+enum class match {
+  //! @brief The first element in pre-order.
+  first,
+  //! @brief Any element, the earliest found.
+  any
+};
+
+//! @brief Searches an element satisfying a predicate, in pre-order.
+//!
+//! @details Equivalent to `std::find_if` over the container iterators.
+//!
+//! @tparam Type The type template parameter of the contained data in the tree
+//! elements.
+//! @tparam Allocator The type template parameter of the allocator for the nodes
+//! of the tree elements.
+//! @tparam NodePolicy The type template parameter of the node policy of the
+//! tree.
+//! @tparam Predicate The unary predicate type.
+//!
+//! @param policy The sequenced execution policy.
+//! @param container The container of the elements.
+//! @param predicate The unary predicate.
+//!
+//! @return The iterator to the first element satisfying the predicate in
+//! pre-order, or the ending iterator.
+//!
+//! @complexity Linear in the size of the container.
+template <typename Type, typename Allocator, typename NodePolicy,
+          typename Predicate>
+[[nodiscard]] constexpr auto
+find_if([[maybe_unused]] const sequenced_policy &policy,
+        const tree<Type, Allocator, NodePolicy> &container, Predicate predicate)
+{
+  auto position = container.begin();
+  while (position != container.end() &&
+         !std::invoke(predicate, *position)) {
+    ++position;
+  }
+
+  return position;
+}
+
+//! @brief Searches an element satisfying a predicate, in parallel.
+//!
+//! @details The subtrees of the container are searched by a team of threads
+//! by work stealing. The predicate is invoked concurrently. Searching any
+//! match stops the team at the first element found. Searching the first match
+//! in pre-order compares the pre-order positions of the matches, in constant
+//! time with the order node policy: the team prunes every subtree following
+//! the best match found so far in pre-order, and completes once the subtrees
+//! preceding it are searched. The first exception thrown by the predicate
+//! stops the search and is rethrown.
+//!
+//! @tparam Type The type template parameter of the contained data in the tree
+//! elements.
+//! @tparam Allocator The type template parameter of the allocator for the nodes
+//! of the tree elements.
+//! @tparam NodePolicy The type template parameter of the node policy of the
+//! tree.
+//! @tparam Predicate The unary predicate type.
+//!
+//! @param policy The parallel execution policy.
+//! @param container The container of the elements.
+//! @param predicate The unary predicate.
+//! @param found The match searched, the first in pre-order by default.
+//!
+//! @return The iterator to the matched element satisfying the predicate, or
+//! the ending iterator.
+//!
+//! @complexity Linear in the size of the container.
+template <typename Type, typename Allocator, typename NodePolicy,
+          typename Predicate>
+[[nodiscard]] auto find_if(const parallel_policy &policy,
+                           const tree<Type, Allocator, NodePolicy> &container,
+                           Predicate predicate, match found = match::first)
+{
+  using internal_node_type = std::remove_pointer_t<decltype(
+      container.begin().node)>;
+
+  std::atomic<internal_node_type *> best{ nullptr };
+  internal_parallel_visit(
+      policy, container.begin().node,
+      [&best, &predicate, found](std::size_t, internal_node_type *node) {
+        internal_node_type *current{ best.load(std::memory_order_acquire) };
+        if (current && (found == match::any || current->precedes(node))) {
+          return internal_visit_type::prune;
+        }
+        if (!std::invoke(predicate, std::as_const(node->data))) {
+          return internal_visit_type::descend;
+        }
+        if (found == match::any) {
+          best.compare_exchange_strong(current, node,
+                                       std::memory_order_acq_rel);
+          return internal_visit_type::stop;
+        }
+        while (!current || node->precedes(current)) {
+          if (best.compare_exchange_weak(current, node,
+                                         std::memory_order_acq_rel)) {
+            break;
+          }
+        }
+        return internal_visit_type::prune;
+      });
+
+  return typename tree<Type, Allocator, NodePolicy>::const_iterator{
+    best.load()
+  };
+}
+
+//! @brief Checks whether any element satisfies a predicate.
+//!
+//! @details The parallel overload stops the team at the first element found
+//! to satisfy the predicate.
+//!
+//! @tparam Policy The execution policy type, sequenced or parallel.
+//! @tparam Type The type template parameter of the contained data in the tree
+//! elements.
+//! @tparam Allocator The type template parameter of the allocator for the nodes
+//! of the tree elements.
+//! @tparam NodePolicy The type template parameter of the node policy of the
+//! tree.
+//! @tparam Predicate The unary predicate type.
+//!
+//! @param policy The execution policy.
+//! @param container The container of the elements.
+//! @param predicate The unary predicate.
+//!
+//! @return `true` if an element satisfies the predicate, `false` otherwise.
+//!
+//! @complexity Linear in the size of the container.
+template <typename Policy, typename Type, typename Allocator,
+          typename NodePolicy, typename Predicate>
+  requires std::is_same_v<Policy, sequenced_policy> ||
+           std::is_same_v<Policy, parallel_policy>
+[[nodiscard]] constexpr bool
+any_of(const Policy &policy, const tree<Type, Allocator, NodePolicy> &container,
+       Predicate predicate)
+{
+  if constexpr (std::is_same_v<Policy, parallel_policy>) {
+    return find_if(policy, container, predicate, match::any) !=
+           container.end();
+  } else {
+    return find_if(policy, container, predicate) != container.end();
+  }
+}
+
+//! @}
+
+//! @name Traversing Operations
+//! @{
+
+//! @brief Applies a function to every element of the container, in
+//! pre-order.
+//!
+//! @details The sequenced overload is equivalent to `std::for_each` over the
+//! container iterators.
+//!
+//! @tparam Type The type template parameter of the contained data in the tree
+//! elements.
+//! @tparam Allocator The type template parameter of the allocator for the nodes
+//! of the tree elements.
+//! @tparam NodePolicy The type template parameter of the node policy of the
+//! tree.
+//! @tparam Function The function type, invocable with a reference to an
+//! element.
+//!
+//! @param policy The sequenced execution policy.
+//! @param container The container of the elements.
+//! @param function The function to apply.
+//!
+//! @complexity Linear in the size of the container.
+template <typename Type, typename Allocator, typename NodePolicy,
+          typename Function>
+constexpr void for_each([[maybe_unused]] const sequenced_policy &policy,
+                        tree<Type, Allocator, NodePolicy> &container,
+                        Function function)
+{
+  for (auto &element : container) {
+    std::invoke(function, element);
+  }
+}
+
+//! @brief Applies a function to every element of the constant container, in
+//! pre-order.
+//!
+//! @copydetails for_each(const sequenced_policy &, tree<Type, Allocator,
+//! NodePolicy> &, Function)
+template <typename Type, typename Allocator, typename NodePolicy,
+          typename Function>
+constexpr void for_each([[maybe_unused]] const sequenced_policy &policy,
+                        const tree<Type, Allocator, NodePolicy> &container,
+                        Function function)
+{
+  for (const auto &element : container) {
+    std::invoke(function, element);
+  }
+}
+
+//! @brief Applies a function to every element of the container, in parallel.
+//!
+//! @details The subtrees of the container are visited by a team of threads
+//! that steal the unvisited child subtrees of each other. Every thread visits
+//! its subtrees in pre-order, the elements are visited in an unspecified order
+//! across the team. The function is shared by the team and invoked
+//! concurrently. The traversal scales with the number of threads on bushy
+//! containers and degrades to a sequential traversal on chains. The first
+//! exception thrown by the function stops the traversal and is rethrown.
+//!
+//! @tparam Type The type template parameter of the contained data in the tree
+//! elements.
+//! @tparam Allocator The type template parameter of the allocator for the nodes
+//! of the tree elements.
+//! @tparam NodePolicy The type template parameter of the node policy of the
+//! tree.
+//! @tparam Function The function type, invocable with a reference to an
+//! element.
+//!
+//! @param policy The parallel execution policy.
+//! @param container The container of the elements.
+//! @param function The function to apply.
+//!
+//! @complexity Linear in the size of the container.
+template <typename Type, typename Allocator, typename NodePolicy,
+          typename Function>
+void for_each(const parallel_policy &policy,
+              tree<Type, Allocator, NodePolicy> &container, Function function)
+{
+  internal_parallel_visit(policy, container.begin().node,
+                          [&function](std::size_t, auto *node) {
+                            std::invoke(function, node->data);
+                            return internal_visit_type::descend;
+                          });
+}
+
+//! @brief Applies a function to every element of the constant container, in
+//! parallel.
+//!
+//! @copydetails for_each(const parallel_policy &, tree<Type, Allocator,
+//! NodePolicy> &, Function)
+template <typename Type, typename Allocator, typename NodePolicy,
+          typename Function>
+void for_each(const parallel_policy &policy,
+              const tree<Type, Allocator, NodePolicy> &container,
+              Function function)
+{
+  internal_parallel_visit(
+      policy, container.begin().node,
+      [&function](std::size_t, const auto *node) {
+        std::invoke(function, std::as_const(node->data));
+        return internal_visit_type::descend;
+      });
+}
+
+//! @brief Propagates the elements of the container from the parents down to
+//! their children, in pre-order.
+//!
+//! @details The function is applied to every element but the root with the
+//! element of its parent, after its parent was itself propagated to. The
+//! propagation inherits a setting from the ancestors, for example.
+//!
+//! @tparam Type The type template parameter of the contained data in the tree
+//! elements.
+//! @tparam Allocator The type template parameter of the allocator for the nodes
+//! of the tree elements.
+//! @tparam NodePolicy The type template parameter of the node policy of the
+//! tree.
+//! @tparam Function The function type, invocable with a constant reference to
+//! the parent element and a reference to the child element.
+//!
+//! @param policy The sequenced execution policy.
+//! @param container The container of the elements.
+//! @param function The function to apply.
+//!
+//! @complexity Linear in the size of the container.
+template <typename Type, typename Allocator, typename NodePolicy,
+          typename Function>
+constexpr void propagate_down([[maybe_unused]] const sequenced_policy &policy,
+                              tree<Type, Allocator, NodePolicy> &container,
+                              Function function)
+{
+  for (auto *node = container.begin().node; node; node = node->next()) {
+    if (node->parent) {
+      std::invoke(function, std::as_const(node->parent->data), node->data);
+    }
+  }
+}
+
+//! @brief Propagates the elements of the container from the parents down to
+//! their children, in parallel level by level.
+//!
+//! @details A level index of the elements by depth is built in one pre-order
+//! pass. Every level is then split among a team of threads, with a barrier
+//! between the levels, so that a parent is propagated to before its
+//! children. The elements of a level are propagated to in an unspecified
+//! order. The function is shared by the team and invoked concurrently. The
+//! propagation scales with the width of the levels and degrades to a
+//! sequential propagation on chains. The first exception thrown by the
+//! function stops the propagation and is rethrown.
+//!
+//! @tparam Type The type template parameter of the contained data in the tree
+//! elements.
+//! @tparam Allocator The type template parameter of the allocator for the nodes
+//! of the tree elements.
+//! @tparam NodePolicy The type template parameter of the node policy of the
+//! tree.
+//! @tparam Function The function type, invocable with a constant reference to
+//! the parent element and a reference to the child element.
+//!
+//! @param policy The parallel execution policy.
+//! @param container The container of the elements.
+//! @param function The function to apply.
+//!
+//! @complexity Linear in the size of the container.
+template <typename Type, typename Allocator, typename NodePolicy,
+          typename Function>
+void propagate_down(const parallel_policy &policy,
+                    tree<Type, Allocator, NodePolicy> &container,
+                    Function function)
+{
+  auto *root{ container.begin().node };
+  using internal_node_type = std::remove_pointer_t<decltype(root)>;
+
+  // The levels below the root, the root has no parent to propagate from. The
+  // ancestors of the node are the path walked from the root in pre-order.
+  std::vector<std::vector<internal_node_type *>> levels;
+  std::vector<internal_node_type *> ancestors;
+  for (auto *node = root; node; node = node->next()) {
+    while (!ancestors.empty() && ancestors.back() != node->parent) {
+      ancestors.pop_back();
+    }
+    if (const std::size_t depth{ ancestors.size() }; depth) {
+      if (depth > levels.size()) {
+        levels.emplace_back();
+      }
+      levels[depth - 1].push_back(node);
+    }
+    ancestors.push_back(node);
+  }
+
+  internal_parallel_levels(policy, levels,
+                           [&function](std::size_t, internal_node_type *node) {
+                             std::invoke(function,
+                                         std::as_const(node->parent->data),
+                                         node->data);
+                           });
+}
+
+//! @}
+
+//! @name Reducing Operations
+//! @{
+
+//! @brief Reduces the transformed elements of the container, in pre-order.
+//!
+//! @details Folds the initial value and the transformed elements from the
+//! left, in pre-order. Equivalent to `std::transform_reduce` over the
+//! container iterators.
+//!
+//! @tparam Type The type template parameter of the contained data in the tree
+//! elements.
+//! @tparam Allocator The type template parameter of the allocator for the nodes
+//! of the tree elements.
+//! @tparam NodePolicy The type template parameter of the node policy of the
+//! tree.
+//! @tparam Result The type of the result.
+//! @tparam Reduce The binary reduction operation type.
+//! @tparam Transform The unary transformation operation type.
+//!
+//! @param policy The sequenced execution policy.
+//! @param container The container of the elements.
+//! @param init The initial value of the reduction.
+//! @param reduce The binary reduction operation.
+//! @param transform The unary transformation operation of every element.
+//!
+//! @return The reduction of the initial value and of the transformed elements.
+//!
+//! @complexity Linear in the size of the container.
+template <typename Type, typename Allocator, typename NodePolicy,
+          typename Result, typename Reduce, typename Transform>
+[[nodiscard]] constexpr Result
+transform_reduce([[maybe_unused]] const sequenced_policy &policy,
+                 const tree<Type, Allocator, NodePolicy> &container,
+                 Result init, Reduce reduce, Transform transform)
+{
+  for (const auto &element : container) {
+    init = std::invoke(reduce, std::move(init),
+                       std::invoke(transform, element));
+  }
+
+  return init;
+}
+
+//! @brief Reduces the transformed elements of the container, in parallel.
+//!
+//! @details The subtrees of the container are partitioned among a team of
+//! threads by work stealing. Every thread reduces the transformed elements it
+//! visits into its own partial result, and the partial results are reduced
+//! into the initial value once the team completes. The reduction operation
+//! must be associative and commutative, as the grouping and the order of the
+//! elements are unspecified. The transformation and reduction operations are
+//! invoked concurrently. The first exception thrown by an operation stops the
+//! reduction and is rethrown.
+//!
+//! @tparam Type The type template parameter of the contained data in the tree
+//! elements.
+//! @tparam Allocator The type template parameter of the allocator for the nodes
+//! of the tree elements.
+//! @tparam NodePolicy The type template parameter of the node policy of the
+//! tree.
+//! @tparam Result The type of the result.
+//! @tparam Reduce The binary reduction operation type.
+//! @tparam Transform The unary transformation operation type.
+//!
+//! @param policy The parallel execution policy.
+//! @param container The container of the elements.
+//! @param init The initial value of the reduction.
+//! @param reduce The binary reduction operation.
+//! @param transform The unary transformation operation of every element.
+//!
+//! @return The reduction of the initial value and of the transformed elements.
+//!
+//! @complexity Linear in the size of the container.
+template <typename Type, typename Allocator, typename NodePolicy,
+          typename Result, typename Reduce, typename Transform>
+[[nodiscard]] Result
+transform_reduce(const parallel_policy &policy,
+                 const tree<Type, Allocator, NodePolicy> &container,
+                 Result init, Reduce reduce, Transform transform)
+{
+  struct alignas(64) internal_partial_type {
+    std::optional<Result> value;
+  };
+
+  std::vector<internal_partial_type> partials(internal_concurrency(policy));
+  internal_parallel_visit(
+      policy, container.begin().node,
+      [&partials, &reduce, &transform](std::size_t index, const auto *node) {
+        std::optional<Result> &partial = partials[index].value;
+        if (partial) {
+          *partial = std::invoke(reduce, std::move(*partial),
+                                 std::invoke(transform, node->data));
+        } else {
+          partial.emplace(std::invoke(transform, node->data));
+        }
+        return internal_visit_type::descend;
+      });
+
+  for (internal_partial_type &partial : partials) {
+    if (partial.value) {
+      init = std::invoke(reduce, std::move(init), std::move(*partial.value));
+    }
+  }
+
+  return init;
+}
+
+//! @brief Reduces the elements of the container.
+//!
+//! @details Equivalent to the transform-reduction of the elements with the
+//! identity transformation, with the same execution policy.
+//!
+//! @tparam Policy The execution policy type, sequenced or parallel.
+//! @tparam Type The type template parameter of the contained data in the tree
+//! elements.
+//! @tparam Allocator The type template parameter of the allocator for the nodes
+//! of the tree elements.
+//! @tparam NodePolicy The type template parameter of the node policy of the
+//! tree.
+//! @tparam Result The type of the result.
+//! @tparam Reduce The binary reduction operation type.
+//!
+//! @param policy The execution policy.
+//! @param container The container of the elements.
+//! @param init The initial value of the reduction.
+//! @param reduce The binary reduction operation, the sum by default.
+//!
+//! @return The reduction of the initial value and of the elements.
+//!
+//! @complexity Linear in the size of the container.
+template <typename Policy, typename Type, typename Allocator,
+          typename NodePolicy, typename Result, typename Reduce = std::plus<>>
+  requires std::is_same_v<Policy, sequenced_policy> ||
+           std::is_same_v<Policy, parallel_policy>
+[[nodiscard]] constexpr Result
+reduce(const Policy &policy, const tree<Type, Allocator, NodePolicy> &container,
+       Result init, Reduce reduce = {})
+{
+  return transform_reduce(policy, container, std::move(init), reduce,
+                          std::identity{});
+}
+
+//! @}
+
+//! @name Internal Implementation Functions
+//! @{
+
+//! @brief Partitions a pre-order sequence into balanced chunks.
+//!
+//! @param position The beginning container iterator of the sequence.
+//! @param size The number of elements of the sequence.
+//! @param count The number of chunks.
+//!
+//! @return The chunks, as pre-order ranges.
+//!
+//! @complexity Linear in the size of the sequence.
+template <TreeMemberIterator Iterator, typename Size>
+[[nodiscard]] auto internal_partition(Iterator position, Size size, Size count)
+{
+  using iterator_type = depth_first_pre_order_iterator_type<Iterator>;
+
+  std::vector<std::ranges::subrange<iterator_type>> chunks;
+  chunks.reserve(count);
+  iterator_type first{ position.node };
+  for (Size index = 0; index < count; ++index) {
+    iterator_type last{ first };
+    for (Size length = size / count + (index < size % count); length;
+         --length) {
+      ++last;
+    }
+    chunks.emplace_back(first, last);
+    first = last;
+  }
+
+  return chunks;
+}
+
+//! @brief Indexes the nodes of a subtree by pre-order position.
+//!
+//! @details The index holds the nodes, the position of their parent, and the
+//! size of their subtree, by pre-order position. The subtree of a node is the
+//! range of positions from the node position to the node position plus its
+//! size. The first child of a node follows it, and every child is followed by
+//! its next sibling after its subtree.
+//!
+//! @param root The root node of the subtree, or `nullptr`.
+//!
+//! @return The pre-order index of the subtree.
+//!
+//! @complexity Linear in the size of the subtree.
+template <typename Node>
+[[nodiscard]] auto internal_pre_order_index(Node *root)
+{
+  struct internal_index_type {
+    std::vector<Node *> nodes;
+    std::vector<std::size_t> parents;
+    std::vector<std::size_t> sizes;
+  } index;
+
+  // The positions of the ancestors of the node, whose subtree sizes are known
+  // once the walk leaves them.
+  std::vector<std::size_t> ancestors;
+  for (Node *node = root; node; node = node->next()) {
+    const std::size_t position{ index.nodes.size() };
+    for (; !ancestors.empty() && index.nodes[ancestors.back()] != node->parent;
+         ancestors.pop_back()) {
+      index.sizes[ancestors.back()] = position - ancestors.back();
+    }
+    index.nodes.push_back(node);
+    index.parents.push_back(ancestors.empty() ? position : ancestors.back());
+    index.sizes.push_back(0);
+    ancestors.push_back(position);
+  }
+  for (; !ancestors.empty(); ancestors.pop_back()) {
+    index.sizes[ancestors.back()] = index.nodes.size() - ancestors.back();
+  }
+
+  return index;
+}
+
+//! @brief Folds a node with the results of its children.
+//!
+//! @details The results of the children are required. The result of the node
+//! is the leaf function of its element, combined with the results of its
+//! children from left to right.
+//!
+//! @param index The pre-order index of the subtree.
+//! @param position The pre-order position of the node.
+//! @param results The results by pre-order position.
+//! @param leaf The leaf function.
+//! @param combine The combine function.
+//!
+//! @complexity Linear in the number of children of the node.
+template <typename Index, typename Result, typename Leaf, typename Combine>
+void internal_fold(const Index &index, std::size_t position,
+                   std::vector<std::optional<Result>> &results, Leaf &leaf,
+                   Combine &combine)
+{
+  Result result{ std::invoke(leaf,
+                             std::as_const(index.nodes[position]->data)) };
+  for (std::size_t child = position + 1;
+       child < position + index.sizes[position]; child += index.sizes[child]) {
+    result = std::invoke(combine, std::move(result),
+                         std::as_const(*results[child]));
+  }
+  results[position].emplace(std::move(result));
+}
+
+//! @}
+
+//! @name Partitioning Operations
+//! @{
+
+//! @brief Partitions the container into balanced chunks of consecutive
+//! elements in pre-order.
+//!
+//! @details The pre-order traversal of the container is cut into `count`
+//! disjoint ranges whose sizes differ by at most one element, covering the
+//! container in order. A chunk holds whole subtrees, except for the subtrees
+//! straddling its boundaries, and may be traversed independently of the
+//! others, such as by one thread each. The trailing chunks are empty when
+//! there are more chunks than elements. The chunks are found in a single
+//! pre-order pass over the elements.
+//!
+//! @tparam Type The type template parameter of the contained data in the tree
+//! elements.
+//! @tparam Allocator The type template parameter of the allocator for the nodes
+//! of the tree elements.
+//! @tparam NodePolicy The type template parameter of the node policy of the
+//! tree.
+//!
+//! @param container The container to partition.
+//! @param count The number of chunks.
+//!
+//! @return The chunks, as pre-order ranges.
+//!
+//! @complexity Linear in the size of the container.
+template <typename Type, typename Allocator, typename NodePolicy>
+[[nodiscard]] auto
+partition(tree<Type, Allocator, NodePolicy> &container,
+          typename tree<Type, Allocator, NodePolicy>::size_type count)
+{
+  return internal_partition(container.begin(), container.size(), count);
+}
+
+//! @brief Partitions the constant container into balanced chunks of
+//! consecutive elements in pre-order.
+//!
+//! @copydetails partition(tree<Type, Allocator, NodePolicy> &, typename
+//! tree<Type, Allocator, NodePolicy>::size_type)
+template <typename Type, typename Allocator, typename NodePolicy>
+[[nodiscard]] auto
+partition(const tree<Type, Allocator, NodePolicy> &container,
+          typename tree<Type, Allocator, NodePolicy>::size_type count)
+{
+  return internal_partition(container.begin(), container.size(), count);
+}
+
+//! @}
+
+//! @name Folding Operations
+//! @{
+
+//! @brief Folds the elements of the container from the children up to their
+//! parents, in reverse pre-order.
+//!
+//! @details The result of an element is the leaf function of the element,
+//! combined with the results of its children from left to right. The result
+//! of a leaf is the leaf function of the element. The fold computes subtree
+//! sizes, costs, or hashes, for example. The results are indexed by the
+//! pre-order position of their element, the result of the root is first.
+//!
+//! @tparam Type The type template parameter of the contained data in the tree
+//! elements.
+//! @tparam Allocator The type template parameter of the allocator for the nodes
+//! of the tree elements.
+//! @tparam NodePolicy The type template parameter of the node policy of the
+//! tree.
+//! @tparam Leaf The leaf function type, invocable with a constant reference to
+//! an element.
+//! @tparam Combine The combine function type, invocable with a result and a
+//! constant reference to the result of a child.
+//!
+//! @param policy The sequenced execution policy.
+//! @param container The container of the elements.
+//! @param leaf The leaf function.
+//! @param combine The combine function.
+//!
+//! @return The results by pre-order position.
+//!
+//! @complexity Linear in the size of the container.
+template <typename Type, typename Allocator, typename NodePolicy, typename Leaf,
+          typename Combine>
+[[nodiscard]] auto fold_up([[maybe_unused]] const sequenced_policy &policy,
+                           const tree<Type, Allocator, NodePolicy> &container,
+                           Leaf leaf, Combine combine)
+{
+  using result_type = std::decay_t<std::invoke_result_t<Leaf &, const Type &>>;
+
+  const auto index{ internal_pre_order_index(container.begin().node) };
+  std::vector<std::optional<result_type>> results(index.nodes.size());
+  for (std::size_t position = index.nodes.size(); position--;) {
+    internal_fold(index, position, results, leaf, combine);
+  }
+
+  std::vector<result_type> folds;
+  folds.reserve(results.size());
+  for (std::optional<result_type> &result : results) {
+    folds.push_back(std::move(*result));
+  }
+
+  return folds;
+}
+
+//! @brief Folds the elements of the container from the children up to their
+//! parents, in parallel.
+//!
+//! @details The leaves of the container are split among a team of threads.
+//! Every element holds an atomic counter of its unfolded children. The thread
+//! folding the last child of an element folds the element in turn, so an
+//! element is folded only once all its children are done, and the fold climbs
+//! towards the root as far as the children allow. The folds are in an
+//! unspecified order across the team, the combination of the children of an
+//! element is from left to right. The functions are shared by the team and
+//! invoked concurrently. The first exception thrown by a function stops the
+//! fold and is rethrown.
+//!
+//! @copydetails fold_up(const sequenced_policy &, const tree<Type, Allocator,
+//! NodePolicy> &, Leaf, Combine)
+template <typename Type, typename Allocator, typename NodePolicy, typename Leaf,
+          typename Combine>
+[[nodiscard]] auto fold_up(const parallel_policy &policy,
+                           const tree<Type, Allocator, NodePolicy> &container,
+                           Leaf leaf, Combine combine)
+{
+  using result_type = std::decay_t<std::invoke_result_t<Leaf &, const Type &>>;
+
+  const auto index{ internal_pre_order_index(container.begin().node) };
+  std::vector<std::optional<result_type>> results(index.nodes.size());
+  std::vector<std::atomic<std::size_t>> pending(index.nodes.size());
+  std::vector<std::vector<std::size_t>> leaves(1);
+  for (std::size_t position = 0; position < index.nodes.size(); ++position) {
+    if (position) {
+      pending[index.parents[position]].fetch_add(1, std::memory_order_relaxed);
+    }
+    if (index.sizes[position] == 1) {
+      leaves.front().push_back(position);
+    }
+  }
+
+  internal_parallel_levels(
+      policy, leaves, [&](std::size_t, std::size_t position) {
+        internal_fold(index, position, results, leaf, combine);
+
+        // The last folded child of a parent folds the parent.
+        while (position) {
+          position = index.parents[position];
+          if (pending[position].fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            break;
+          }
+          internal_fold(index, position, results, leaf, combine);
+        }
+      });
+
+  std::vector<result_type> folds;
+  folds.reserve(results.size());
+  for (std::optional<result_type> &result : results) {
+    folds.push_back(std::move(*result));
+  }
+
+  return folds;
+}
+
 //! @}
 } // namespace fcarouge
 
@@ -0,0 +1,391 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+//! @file
+//! @brief Tree execution policies header.
+//!
+//! @details The header contains the execution policies of the parallel
+//! algorithms of the tree container, and their work-stealing and
+//! level-synchronous schedulers.
+
+#ifndef FCAROUGE_TREE_EXECUTION_HPP
+#define FCAROUGE_TREE_EXECUTION_HPP
+
+#include <algorithm>
+// std::max std::min
+
+#include <atomic>
+// std::atomic std::memory_order_acquire std::memory_order_acq_rel
+// std::memory_order_relaxed std::memory_order_release
+
+#include <barrier>
+// std::barrier
+
+#include <cstddef>
+// std::ptrdiff_t std::size_t
+
+#include <deque>
+// std::deque
+
+#include <exception>
+// std::current_exception std::exception_ptr std::rethrow_exception
+
+#include <mutex>
+// std::lock_guard std::mutex
+
+#include <system_error>
+// std::system_error
+
+#include <thread>
+// std::thread std::this_thread::yield
+
+#include <vector>
+// std::vector
+
+//! @namespace fcarouge Francois Carouge's projects namespace. Lowers the name
+//! conflict probability in large projects. Use using-declarations or
+//! namespace-alias-definition per your project guidelines.
+namespace fcarouge
+{
+//! @name Execution Policies
+//! @{
+
+//! @brief The sequenced execution policy type.
+//!
+//! @details The algorithm runs on the calling thread.
+struct sequenced_policy {
+};
+
+//! @brief The parallel execution policy type.
+//!
+//! @details The algorithm runs on a team of threads scheduled by work
+//! stealing at the subtree boundaries of the container. The calling thread is
+//! part of the team. The element access functions may run concurrently and
+//! must not introduce data races.
+struct parallel_policy {
+  //! @brief The number of threads of the team, or `0` for the hardware
+  //! concurrency.
+  std::size_t concurrency = 0;
+};
+
+//! @brief The sequenced execution policy.
+inline constexpr sequenced_policy seq{};
+
+//! @brief The parallel execution policy with the hardware concurrency.
+inline constexpr parallel_policy par{};
+
+//! @}
+
+//! @name Internal Implementation Types
+//! @{
+
+//! @brief The continuation of a parallel visit after visiting a node.
+enum class internal_visit_type {
+  //! @brief Continues the visit with the children of the node.
+  descend,
+  //! @brief Continues the visit without the subtree of the node.
+  prune,
+  //! @brief Stops the visit of the team.
+  stop
+};
+
+//! @}
+
+//! @name Internal Implementation Functions
+//! @{
+
+//! @brief The number of threads of the team of a parallel execution policy.
+//!
+//! @param policy The parallel execution policy.
+//!
+//! @return The concurrency of the policy, or the hardware concurrency, at
+//! least one.
+inline std::size_t internal_concurrency(const parallel_policy &policy)
+{
+  return policy.concurrency
+             ? policy.concurrency
+             : std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+//! @brief Visits every node of a subtree with a work-stealing team of
+//! threads.
+//!
+//! @details Every thread owns a deque of pending subtrees shared with the
+//! team, and a private stack of the nodes of the subtree it visits in
+//! pre-order. A thread donates the pending child subtree closest to the root
+//! of its stack to its shared deque when a thread of the team is idle and the
+//! deque is empty. An idle thread takes back its own donations first, then
+//! steals the oldest donation of another thread. A chain never has a pending
+//! child subtree to donate and is visited by a single thread. The first
+//! exception thrown by a visit stops the team and is rethrown. A visit may
+//! prune the subtree of its node, or stop the team.
+//!
+//! @tparam Node The internal node type of the container.
+//! @tparam Visit The visit function type, invocable with the index of the
+//! thread in the team and a node, and returning the continuation of the
+//! visit.
+//!
+//! @param policy The parallel execution policy.
+//! @param root The root node of the subtree to visit, or `nullptr`.
+//! @param visit The visit function. It is invoked concurrently.
+//!
+//! @return The number of threads of the team, a bound of the indexes passed
+//! to the visit function.
+//!
+//! @complexity Linear in the number of nodes visited.
+template <typename Node, typename Visit>
+std::size_t internal_parallel_visit(const parallel_policy &policy, Node *root,
+                                    Visit &&visit)
+{
+  const std::size_t concurrency{ internal_concurrency(policy) };
+  if (!root) {
+    return concurrency;
+  }
+
+  struct alignas(64) internal_worker_type {
+    std::mutex mutex;
+    std::deque<Node *> donations;
+    std::atomic<std::size_t> size{ 0 };
+  };
+
+  std::vector<internal_worker_type> workers(concurrency);
+  std::atomic<std::size_t> outstanding{ 1 };
+  std::atomic<std::size_t> idle{ 0 };
+  std::atomic<bool> stopped{ false };
+  std::mutex exception_mutex;
+  std::exception_ptr exception;
+
+  workers[0].donations.push_back(root);
+  workers[0].size.store(1, std::memory_order_relaxed);
+
+  // Takes the most recent donation of a thread, or the oldest donation of
+  // another thread.
+  const auto take = [&workers, concurrency](std::size_t index) -> Node * {
+    for (std::size_t offset = 0; offset < concurrency; ++offset) {
+      internal_worker_type &worker = workers[(index + offset) % concurrency];
+      if (!worker.size.load(std::memory_order_acquire)) {
+        continue;
+      }
+      const std::lock_guard lock{ worker.mutex };
+      if (worker.donations.empty()) {
+        continue;
+      }
+      Node *task{ nullptr };
+      if (offset) {
+        task = worker.donations.front();
+        worker.donations.pop_front();
+      } else {
+        task = worker.donations.back();
+        worker.donations.pop_back();
+      }
+      worker.size.store(worker.donations.size(), std::memory_order_release);
+
+      return task;
+    }
+
+    return nullptr;
+  };
+
+  const auto work = [&](std::size_t index) {
+    internal_worker_type &self = workers[index];
+    std::deque<Node *> stack;
+    bool waiting = false;
+    while (true) {
+      Node *task = take(index);
+      if (!task) {
+        if (!outstanding.load(std::memory_order_acquire)) {
+          break;
+        }
+        if (!waiting) {
+          waiting = true;
+          idle.fetch_add(1, std::memory_order_relaxed);
+        }
+        std::this_thread::yield();
+        continue;
+      }
+      if (waiting) {
+        waiting = false;
+        idle.fetch_sub(1, std::memory_order_relaxed);
+      }
+
+      // Visit the subtree of the task in pre-order...
+      stack.push_back(task);
+      while (!stack.empty() && !stopped.load(std::memory_order_relaxed)) {
+        Node *node = stack.back();
+        stack.pop_back();
+        internal_visit_type next{ internal_visit_type::stop };
+        try {
+          next = visit(index, node);
+        } catch (...) {
+          const std::lock_guard lock{ exception_mutex };
+          if (!exception) {
+            exception = std::current_exception();
+          }
+        }
+        if (next == internal_visit_type::stop) {
+          stopped.store(true, std::memory_order_relaxed);
+        } else if (next == internal_visit_type::descend) {
+          for (Node *child = node->last_child; child;
+               child = child->left_sibling) {
+            stack.push_back(child);
+          }
+        }
+
+        // ...donating the largest pending subtree to an idle thread.
+        if (stack.size() > 1 && idle.load(std::memory_order_relaxed) &&
+            !self.size.load(std::memory_order_relaxed)) {
+          outstanding.fetch_add(1, std::memory_order_relaxed);
+          const std::lock_guard lock{ self.mutex };
+          self.donations.push_back(stack.front());
+          self.size.store(self.donations.size(), std::memory_order_release);
+          stack.pop_front();
+        }
+      }
+      stack.clear();
+      outstanding.fetch_sub(1, std::memory_order_acq_rel);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(concurrency - 1);
+  for (std::size_t index = 1; index < concurrency; ++index) {
+    try {
+      threads.emplace_back(work, index);
+    } catch (const std::system_error &) {
+      // The team continues without the thread, its deque remains empty.
+      break;
+    }
+  }
+  work(0);
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+
+  return concurrency;
+}
+
+//! @brief Visits every task of a sequence of levels with a team of threads,
+//! one level after the other.
+//!
+//! @details The threads of the team split each level in chunks claimed from a
+//! shared cursor, and wait for each other at a barrier before the next level.
+//! The visits of a level happen before the visits of the next level. The
+//! first exception thrown by a visit skips the remaining visits and is
+//! rethrown.
+//!
+//! @tparam Task The task type, such as an internal node pointer of the
+//! container.
+//! @tparam Visit The visit function type, invocable with the index of the
+//! thread in the team and a task.
+//!
+//! @param policy The parallel execution policy.
+//! @param levels The tasks to visit, by level.
+//! @param visit The visit function. It is invoked concurrently.
+//!
+//! @return The number of threads of the team, a bound of the indexes passed
+//! to the visit function.
+//!
+//! @complexity Linear in the number of tasks visited.
+template <typename Task, typename Visit>
+std::size_t
+internal_parallel_levels(const parallel_policy &policy,
+                         const std::vector<std::vector<Task>> &levels,
+                         Visit &&visit)
+{
+  const std::size_t concurrency{ internal_concurrency(policy) };
+  if (levels.empty()) {
+    return concurrency;
+  }
+
+  std::vector<std::atomic<std::size_t>> cursors(levels.size());
+  std::barrier<> barrier{ static_cast<std::ptrdiff_t>(concurrency) };
+  std::atomic<bool> stopped{ false };
+  std::mutex exception_mutex;
+  std::exception_ptr exception;
+
+  const auto work = [&](std::size_t index) {
+    for (std::size_t level = 0; level < levels.size(); ++level) {
+      const std::vector<Task> &tasks{ levels[level] };
+      const std::size_t grain{ std::max<std::size_t>(
+          tasks.size() / (concurrency * 8), 1) };
+      while (!stopped.load(std::memory_order_relaxed)) {
+        const std::size_t first{ cursors[level].fetch_add(
+            grain, std::memory_order_relaxed) };
+        if (first >= tasks.size()) {
+          break;
+        }
+        const std::size_t last{ std::min(first + grain, tasks.size()) };
+        try {
+          for (std::size_t position = first; position < last; ++position) {
+            visit(index, tasks[position]);
+          }
+        } catch (...) {
+          stopped.store(true, std::memory_order_relaxed);
+          const std::lock_guard lock{ exception_mutex };
+          if (!exception) {
+            exception = std::current_exception();
+          }
+        }
+      }
+      barrier.arrive_and_wait();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(concurrency - 1);
+  for (std::size_t index = 1; index < concurrency; ++index) {
+    try {
+      threads.emplace_back(work, index);
+    } catch (const std::system_error &) {
+      // The team continues without the threads, they leave the barrier.
+      for (; index < concurrency; ++index) {
+        barrier.arrive_and_drop();
+      }
+      break;
+    }
+  }
+  work(0);
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+
+  return concurrency;
+}
+
+//! @}
+} // namespace fcarouge
+
+#endif // FCAROUGE_TREE_EXECUTION_HPP
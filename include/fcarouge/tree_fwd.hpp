@@ -48,6 +48,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 // std::uint_least8_t std::uint16_t std::uint32_t std::uint64_t std::uint8_t
 // std::uintmax_t std::uintptr_t
 
+#include <functional>
+// std::identity std::plus
+
 #include <memory>
 // std::allocator
 
@@ -62,10 +65,49 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 //! namespace-alias-definition per your project guidelines.
 namespace fcarouge
 {
+//! @name Policy Types
+//! @{
+
+//! @brief The node policy of the tree container.
+//!
+//! @details Opts in the caches maintained in every node of the container. A
+//! cache speeds up its queries at the cost of its storage in every node and
+//! of its maintenance on every insertion and removal. No cache is maintained
+//! by default.
+//!
+//! @tparam Level Whether every node caches its level in the hierarchy, for
+//! constant time depth queries.
+//! @tparam Order Whether every node maintains its order labels in the Euler
+//! tour of the container, for constant time ancestry and pre-order queries.
+//! @tparam Thread Whether every node is threaded to its pre-order successor,
+//! for worst-case constant time pre-order increments.
+template <bool Level = false, bool Order = false, bool Thread = false>
+struct node_policy {
+  //! @brief Whether every node caches its level in the hierarchy.
+  static constexpr bool level = Level;
+
+  //! @brief Whether every node maintains its order labels.
+  static constexpr bool order = Order;
+
+  //! @brief Whether every node is threaded to its pre-order successor.
+  static constexpr bool thread = Thread;
+};
+
+//! @}
+
 //! @name Forward Type Declarations
 //! @{
 
-template <typename Type, typename Allocator = std::allocator<Type>> class tree;
+template <typename Type, typename Allocator = std::allocator<Type>,
+          typename NodePolicy = node_policy<>>
+class tree;
+
+template <typename Type, typename Allocator = std::allocator<Type>,
+          typename Operation = std::plus<>, typename Projection = std::identity>
+class augmented_tree;
+
+template <typename Type, typename Allocator = std::allocator<Type>>
+class cow_tree;
 
 //! @}
 
@@ -176,9 +218,7 @@ using tree_wstring = tree<std::wstring, Allocator>;
 //! constant container iterator constaints.
 template <typename ConstIterator>
 concept TreeMemberConstIterator = std::is_same_v<
-    ConstIterator,
-    std::remove_cvref_t<typename tree<typename std::iterator_traits<
-        ConstIterator>::value_type>::const_iterator>>;
+    ConstIterator, typename ConstIterator::container_type::const_iterator>;
 
 //! @brief Tree member non-constant container iterators concept.
 //!
@@ -188,9 +228,7 @@ concept TreeMemberConstIterator = std::is_same_v<
 //! non-constant container iterator constaints.
 template <typename NonConstIterator>
 concept TreeMemberNonConstIterator = std::is_same_v<
-    NonConstIterator,
-    std::remove_cvref_t<typename tree<typename std::iterator_traits<
-        NonConstIterator>::value_type>::iterator>>;
+    NonConstIterator, typename NonConstIterator::container_type::iterator>;
 
 //! @brief Tree member iterators concept.
 //!
@@ -0,0 +1,1178 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+//! @file
+//! @brief Tree indexes header.
+//!
+//! @details The header contains the non-member indexes built from, and
+//! applicable to the tree container. An index is built on demand from the
+//! container and rebuilt on the next query following a modification of the
+//! container's topology.
+
+#ifndef FCAROUGE_TREE_INDEX_HPP
+#define FCAROUGE_TREE_INDEX_HPP
+
+#include <algorithm>
+// std::max std::minmax
+
+#include <bit>
+// std::bit_width
+
+#include <functional>
+// std::equal_to std::hash std::invoke
+
+#include <memory>
+// std::addressof std::allocator_traits
+
+#include <type_traits>
+// std::invoke_result_t std::remove_cvref_t std::remove_pointer_t
+
+#include <unordered_map>
+// std::unordered_map
+
+#include <utility>
+// std::move std::pair
+
+#include <vector>
+// std::vector
+
+#include "tree_index_fwd.hpp"
+
+#include "tree_iterator_fwd.hpp"
+
+#include "tree_fwd.hpp"
+
+//! @namespace fcarouge Francois Carouge's projects namespace. Lowers the name
+//! conflict probability in large projects. Use using-declarations or
+//! namespace-alias-definition per your project guidelines.
+namespace fcarouge
+{
+//! @brief Pre-order numbering of the nodes of a tree container.
+//!
+//! @details Implementation detail shared by the container indexes. The nodes
+//! are numbered in pre-order with their levels, and the pre-order positions of
+//! their parents. The numbering remembers the revision of the container it was
+//! built from to detect when it is outdated.
+//!
+//! @tparam Type The type template parameter of the contained data in the tree
+//! elements.
+//! @tparam Allocator The type template parameter of the allocator for the nodes
+//! of the tree elements, rebound for the memory of the numbering.
+//! @tparam NodePolicy The type template parameter of the node policy of the
+//! tree.
+template <typename Type, typename Allocator, typename NodePolicy>
+struct internal_pre_order_numbering_type {
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The type of the numbered container.
+  using container_type = tree<Type, Allocator, NodePolicy>;
+
+  //! @brief The unsigned integer type to represent element counts.
+  using size_type = typename container_type::size_type;
+
+  //! @brief The signed integer type of the node levels.
+  using level_type = typename container_type::difference_type;
+
+  //! @brief The internal node data structure type containing the element data.
+  using internal_node_type = std::remove_pointer_t<decltype(
+      container_type::const_iterator::node)>;
+
+  //! @brief The allocator type rebound to the value type of the numbering.
+  template <typename Value>
+  using allocator_type =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Value>;
+
+  //! @brief The type of a sequence of the numbering.
+  template <typename Value>
+  using sequence_type = std::vector<Value, allocator_type<Value>>;
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief Constructs the numbering of a container.
+  //!
+  //! @details The numbering is built on demand. The container must outlive
+  //! the numbering.
+  //!
+  //! @param container The container to number.
+  //!
+  //! @complexity Constant.
+  explicit internal_pre_order_numbering_type(const container_type &container)
+          : container{ std::addressof(container) },
+            nodes{ allocator_type<internal_node_type *>{
+                container.get_allocator() } },
+            levels{ allocator_type<level_type>{ container.get_allocator() } },
+            parents{ allocator_type<size_type>{ container.get_allocator() } },
+            positions{ allocator_type<
+                std::pair<const internal_node_type *const, size_type>>{
+                container.get_allocator() } }
+  {
+  }
+
+  //! @brief Whether the container was modified since the numbering was built.
+  //!
+  //! @return `true` if the numbering must be rebuilt, `false` otherwise.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] bool outdated() const noexcept
+  {
+    return !built || revision != container->revision();
+  }
+
+  //! @brief Rebuilds the numbering from the container.
+  //!
+  //! @complexity Linear in the size of the container.
+  void rebuild()
+  {
+    const size_type count = container->size();
+
+    nodes.clear();
+    levels.clear();
+    parents.clear();
+    positions.clear();
+    nodes.reserve(count);
+    levels.reserve(count);
+    parents.reserve(count);
+    positions.reserve(count);
+    for (auto iterator = container->cbegin(); iterator != container->cend();
+         ++iterator) {
+      // The parent precedes its children in pre-order and is already numbered.
+      const internal_node_type *parent = iterator.node->parent;
+      parents.push_back(parent ? positions.find(parent)->second : count);
+      positions.emplace(iterator.node, nodes.size());
+      nodes.push_back(iterator.node);
+      levels.push_back(parent ? levels[parents.back()] + 1 : 0);
+    }
+
+    revision = container->revision();
+    built = true;
+  }
+
+  //! @brief Returns the pre-order position of a node.
+  //!
+  //! @param node The numbered node.
+  //!
+  //! @return The pre-order position of the node.
+  //!
+  //! @complexity Constant on average.
+  [[nodiscard]] size_type position(const internal_node_type *node) const
+  {
+    return positions.find(node)->second;
+  }
+
+  //! @brief Returns the depth of the node at a pre-order position.
+  //!
+  //! @param index The pre-order position of the node.
+  //!
+  //! @return The depth of the node.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] level_type depth(size_type index) const
+  {
+    return levels[index] - levels.front();
+  }
+
+  //! @}
+
+  //! @name Public Member Variables
+  //! @{
+
+  //! @brief The numbered container.
+  const container_type *container;
+
+  //! @brief The revision of the container when the numbering was last built.
+  size_type revision = 0;
+
+  //! @brief Whether the numbering was built.
+  bool built = false;
+
+  //! @brief The nodes of the container in pre-order.
+  sequence_type<internal_node_type *> nodes;
+
+  //! @brief The levels of the nodes in pre-order.
+  sequence_type<level_type> levels;
+
+  //! @brief The pre-order positions of the parents of the nodes in pre-order,
+  //! the size of the container for the root.
+  sequence_type<size_type> parents;
+
+  //! @brief The pre-order positions of the nodes.
+  std::unordered_map<
+      const internal_node_type *, size_type,
+      std::hash<const internal_node_type *>,
+      std::equal_to<const internal_node_type *>,
+      allocator_type<std::pair<const internal_node_type *const, size_type>>>
+      positions;
+
+  //! @}
+};
+
+//! @brief Lowest common ancestor index of a tree container.
+//!
+//! @details The index answers lowest common ancestor queries in constant time
+//! on average: the pre-order positions of the queried nodes are looked up in a
+//! hash table, the range minimum query is constant. The nodes are numbered in
+//! pre-order. For two distinct nodes numbered `i` and `j` with `i < j`, the
+//! lowest common ancestor is the parent of the shallowest node numbered in
+//! `(i, j]`, found by a range minimum query over a sparse table of the node
+//! levels. The sparse table is a variant of the Euler tour
+//! table of half its size. The index is built on the first query and rebuilt on
+//! the next query following a modification of the container's topology.
+//!
+//! @tparam Type The type template parameter of the contained data in the tree
+//! elements.
+//! @tparam Allocator The type template parameter of the allocator for the nodes
+//! of the tree elements, rebound for the memory of the index.
+//! @tparam NodePolicy The type template parameter of the node policy of the
+//! tree.
+template <typename Type, typename Allocator, typename NodePolicy>
+class lowest_common_ancestor_index
+{
+  public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The type of the indexed container.
+  using container_type = tree<Type, Allocator, NodePolicy>;
+
+  //! @brief The unsigned integer type to represent element counts.
+  using size_type = typename container_type::size_type;
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief Constructs the index of a container.
+  //!
+  //! @details The index is built on the first query. The container must
+  //! outlive the index.
+  //!
+  //! @param container The container to index.
+  //!
+  //! @complexity Constant.
+  explicit lowest_common_ancestor_index(const container_type &container)
+          : numbering{ container },
+            table{ table_allocator_type{ container.get_allocator() } }
+  {
+  }
+
+  //! @}
+
+  //! @name Public Search Member Functions
+  //! @{
+
+  //! @brief Finds the lowest common ancestor of two elements.
+  //!
+  //! @details The lowest common ancestor is the deepest element having both
+  //! elements as descendants, where an element is a descendant of itself. The
+  //! behavior is undefined if either iterator is not a dereferenceable iterator
+  //! of the indexed container.
+  //!
+  //! @tparam Iterator The tree iterator type-constraint template parameter of
+  //! the elements and the result.
+  //!
+  //! @param lhs The iterator to the first element.
+  //! @param rhs The iterator to the second element.
+  //!
+  //! @return The iterator to the lowest common ancestor element.
+  //!
+  //! @complexity Constant on average. Linearithmic in the size of the container
+  //! when the index is rebuilt.
+  template <TreeIterator Iterator>
+  [[nodiscard]] Iterator lowest_common_ancestor(Iterator lhs, Iterator rhs)
+  {
+    if (numbering.outdated()) {
+      rebuild();
+    }
+
+    // The positions are named: a pair of references to temporaries would
+    // dangle.
+    const size_type lhs_position = numbering.position(lhs.node);
+    const size_type rhs_position = numbering.position(rhs.node);
+    const auto [first, last] = std::minmax(lhs_position, rhs_position);
+    if (first == last) {
+      return lhs;
+    }
+
+    return Iterator{ numbering.nodes[shallowest(first + 1, last + 1)]->parent };
+  }
+
+  //! @}
+
+  //! @name Public Modifier Member Functions
+  //! @{
+
+  //! @brief Rebuilds the index from the container.
+  //!
+  //! @details Queries rebuild the index as needed. Rebuilding explicitly
+  //! moves the cost of the construction out of the next query.
+  //!
+  //! @complexity Linearithmic in the size of the container.
+  void rebuild()
+  {
+    numbering.rebuild();
+
+    // The first row of the table are the ranges of one node, each following
+    // row doubles the ranges from the minimums of the previous row.
+    const size_type count = numbering.nodes.size();
+    const auto rows = static_cast<size_type>(std::bit_width(count));
+    table.assign(rows * count, 0);
+    for (size_type index = 0; index < count; ++index) {
+      table[index] = index;
+    }
+    for (size_type row = 1; row < rows; ++row) {
+      const size_type half = size_type{ 1 } << (row - 1);
+      const size_type *previous = table.data() + (row - 1) * count;
+      size_type *current = table.data() + row * count;
+      for (size_type index = 0; index + 2 * half <= count; ++index) {
+        const size_type lhs = previous[index];
+        const size_type rhs = previous[index + half];
+        current[index] =
+            numbering.levels[rhs] < numbering.levels[lhs] ? rhs : lhs;
+      }
+    }
+  }
+
+  //! @}
+
+  private:
+  //! @name Private Member Types
+  //! @{
+
+  //! @brief The pre-order numbering type of the indexed container.
+  using numbering_type =
+      internal_pre_order_numbering_type<Type, Allocator, NodePolicy>;
+
+  //! @brief The allocator type of the table.
+  using table_allocator_type =
+      typename numbering_type::template allocator_type<size_type>;
+
+  //! @}
+
+  //! @name Private Member Functions
+  //! @{
+
+  //! @brief Finds the shallowest node of a non-empty pre-order range.
+  //!
+  //! @param first The position of the first node of the range.
+  //! @param last The position following the last node of the range.
+  //!
+  //! @return The position of the shallowest node of the range.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] size_type shallowest(size_type first, size_type last) const
+  {
+    const auto row = static_cast<size_type>(std::bit_width(last - first) - 1);
+    const size_type *minimums = table.data() + row * numbering.nodes.size();
+    const size_type lhs = minimums[first];
+    const size_type rhs = minimums[last - (size_type{ 1 } << row)];
+
+    return numbering.levels[rhs] < numbering.levels[lhs] ? rhs : lhs;
+  }
+
+  //! @}
+
+  //! @name Private Member Variables
+  //! @{
+
+  //! @brief The pre-order numbering of the indexed container.
+  numbering_type numbering;
+
+  //! @brief The sparse table of the shallowest node positions of the ranges
+  //! of a power of two nodes, one row per power.
+  typename numbering_type::template sequence_type<size_type> table;
+
+  //! @}
+};
+
+//! @brief Ancestor index of a tree container.
+//!
+//! @details The index answers k-th ancestor and level ancestor queries in
+//! logarithmic time by binary lifting. The nodes are numbered in pre-order and
+//! the index records the `2^j`-th ancestor of every node, for every power `j`
+//! up to the height of the container. An ancestor query combines the jumps of
+//! the binary representation of its distance. The index is built on the first
+//! query and rebuilt on the next query following a modification of the
+//! container's topology.
+//!
+//! @tparam Type The type template parameter of the contained data in the tree
+//! elements.
+//! @tparam Allocator The type template parameter of the allocator for the nodes
+//! of the tree elements, rebound for the memory of the index.
+//! @tparam NodePolicy The type template parameter of the node policy of the
+//! tree.
+template <typename Type, typename Allocator, typename NodePolicy>
+class ancestor_index
+{
+  public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The type of the indexed container.
+  using container_type = tree<Type, Allocator, NodePolicy>;
+
+  //! @brief The unsigned integer type to represent element counts.
+  using size_type = typename container_type::size_type;
+
+  //! @brief Signed integer type to represent element distances.
+  using difference_type = typename container_type::difference_type;
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief Constructs the index of a container.
+  //!
+  //! @details The index is built on the first query. The container must
+  //! outlive the index.
+  //!
+  //! @param container The container to index.
+  //!
+  //! @complexity Constant.
+  explicit ancestor_index(const container_type &container)
+          : numbering{ container },
+            table{ table_allocator_type{ container.get_allocator() } }
+  {
+  }
+
+  //! @}
+
+  //! @name Public Search Member Functions
+  //! @{
+
+  //! @brief Finds the k-th ancestor of an element.
+  //!
+  //! @details The 0-th ancestor of an element is itself, its first ancestor is
+  //! its parent, etc... The behavior is undefined if the iterator is not a
+  //! dereferenceable iterator of the indexed container.
+  //!
+  //! @tparam Iterator The tree iterator type-constraint template parameter of
+  //! the element and the result.
+  //!
+  //! @param position The iterator to the element.
+  //! @param distance The number of generations to climb.
+  //!
+  //! @return The iterator to the ancestor element, or the ending iterator if
+  //! the distance is negative or greater than the depth of the element.
+  //!
+  //! @complexity Logarithmic in the distance. Linearithmic in the size of the
+  //! container when the index is rebuilt.
+  template <TreeIterator Iterator>
+  [[nodiscard]] Iterator ancestor(Iterator position, difference_type distance)
+  {
+    if (numbering.outdated()) {
+      rebuild();
+    }
+
+    const size_type index = numbering.position(position.node);
+    if (distance < 0 || distance > numbering.depth(index)) {
+      return Iterator{};
+    }
+
+    return Iterator{ numbering.nodes[climb(index, distance)] };
+  }
+
+  //! @brief Finds the ancestor of an element at a given depth.
+  //!
+  //! @details The level ancestor at depth `0` is the root, the ancestor at the
+  //! depth of the element is itself. The behavior is undefined if the iterator
+  //! is not a dereferenceable iterator of the indexed container.
+  //!
+  //! @tparam Iterator The tree iterator type-constraint template parameter of
+  //! the element and the result.
+  //!
+  //! @param position The iterator to the element.
+  //! @param depth The depth of the ancestor.
+  //!
+  //! @return The iterator to the ancestor element, or the ending iterator if
+  //! the depth is negative or greater than the depth of the element.
+  //!
+  //! @complexity Logarithmic in the depth of the element. Linearithmic in the
+  //! size of the container when the index is rebuilt.
+  template <TreeIterator Iterator>
+  [[nodiscard]] Iterator ancestor_at_depth(Iterator position,
+                                           difference_type depth)
+  {
+    if (numbering.outdated()) {
+      rebuild();
+    }
+
+    const size_type index = numbering.position(position.node);
+    const difference_type distance = numbering.depth(index) - depth;
+    if (depth < 0 || distance < 0) {
+      return Iterator{};
+    }
+
+    return Iterator{ numbering.nodes[climb(index, distance)] };
+  }
+
+  //! @}
+
+  //! @name Public Modifier Member Functions
+  //! @{
+
+  //! @brief Rebuilds the index from the container.
+  //!
+  //! @details Queries rebuild the index as needed. Rebuilding explicitly
+  //! moves the cost of the construction out of the next query.
+  //!
+  //! @complexity Linearithmic in the size of the container.
+  void rebuild()
+  {
+    numbering.rebuild();
+
+    // The first row of the table are the parents, each following row doubles
+    // the jumps of the previous row. The root is its own ancestor to keep the
+    // jumps in bounds, the queries are bounded by the depth beforehand.
+    const size_type count = numbering.nodes.size();
+    difference_type height = 0;
+    for (size_type index = 0; index < count; ++index) {
+      height = std::max(height, numbering.depth(index));
+    }
+    rows = std::max(size_type{ 1 },
+                    static_cast<size_type>(std::bit_width(
+                        static_cast<size_type>(height))));
+    table.assign(rows * count, 0);
+    for (size_type index = 1; index < count; ++index) {
+      table[index] = numbering.parents[index];
+    }
+    for (size_type row = 1; row < rows; ++row) {
+      const size_type *previous = table.data() + (row - 1) * count;
+      size_type *current = table.data() + row * count;
+      for (size_type index = 0; index < count; ++index) {
+        current[index] = previous[previous[index]];
+      }
+    }
+  }
+
+  //! @}
+
+  private:
+  //! @name Private Member Types
+  //! @{
+
+  //! @brief The pre-order numbering type of the indexed container.
+  using numbering_type =
+      internal_pre_order_numbering_type<Type, Allocator, NodePolicy>;
+
+  //! @brief The allocator type of the table.
+  using table_allocator_type =
+      typename numbering_type::template allocator_type<size_type>;
+
+  //! @}
+
+  //! @name Private Member Functions
+  //! @{
+
+  //! @brief Climbs the ancestors of a node.
+  //!
+  //! @param index The pre-order position of the node.
+  //! @param distance The number of generations to climb, at most the depth of
+  //! the node.
+  //!
+  //! @return The pre-order position of the ancestor.
+  //!
+  //! @complexity Logarithmic in the distance.
+  [[nodiscard]] size_type climb(size_type index, difference_type distance) const
+  {
+    const size_type count = numbering.nodes.size();
+    auto jumps = static_cast<size_type>(distance);
+    for (size_type row = 0; jumps; ++row, jumps >>= 1) {
+      if (jumps & 1) {
+        index = table[row * count + index];
+      }
+    }
+
+    return index;
+  }
+
+  //! @}
+
+  //! @name Private Member Variables
+  //! @{
+
+  //! @brief The pre-order numbering of the indexed container.
+  numbering_type numbering;
+
+  //! @brief The number of rows of the table.
+  size_type rows = 0;
+
+  //! @brief The table of the `2^j`-th ancestors positions of the nodes, one
+  //! row per power `j`.
+  typename numbering_type::template sequence_type<size_type> table;
+
+  //! @}
+};
+
+//! @brief Interval index of a tree container.
+//!
+//! @details The index labels every node with the interval of the pre-order
+//! positions of its subtree: the entry label is the pre-order position of the
+//! node and the exit label is the pre-order position of its last descendant.
+//! The labels answer ancestry and ordering queries in constant time. The index
+//! is labeled on the first query and relabeled on the next query following a
+//! modification of the container's topology. The ordering of the nodes is a
+//! strict weak ordering suitable for sorted containers and binary searches of
+//! iterators.
+//!
+//! @tparam Type The type template parameter of the contained data in the tree
+//! elements.
+//! @tparam Allocator The type template parameter of the allocator for the nodes
+//! of the tree elements, rebound for the memory of the index.
+//! @tparam NodePolicy The type template parameter of the node policy of the
+//! tree.
+template <typename Type, typename Allocator, typename NodePolicy>
+class interval_index
+{
+  public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The type of the indexed container.
+  using container_type = tree<Type, Allocator, NodePolicy>;
+
+  //! @brief The unsigned integer type to represent element counts.
+  using size_type = typename container_type::size_type;
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief Constructs the index of a container.
+  //!
+  //! @details The index is labeled on the first query. The container must
+  //! outlive the index.
+  //!
+  //! @param container The container to index.
+  //!
+  //! @complexity Constant.
+  explicit interval_index(const container_type &container)
+          : numbering{ container },
+            exits{ exit_allocator_type{ container.get_allocator() } }
+  {
+  }
+
+  //! @}
+
+  //! @name Public Search Member Functions
+  //! @{
+
+  //! @brief Checks whether an element is an ancestor of another element.
+  //!
+  //! @details An element is an ancestor of itself. The behavior is undefined if
+  //! either iterator is not a dereferenceable iterator of the indexed
+  //! container.
+  //!
+  //! @param ancestor The iterator to the presumed ancestor element.
+  //! @param descendant The iterator to the presumed descendant element.
+  //!
+  //! @return `true` if the interval of the ancestor contains the interval of
+  //! the descendant, `false` otherwise.
+  //!
+  //! @complexity Constant on average. Linear in the size of the container when
+  //! the index is relabeled.
+  [[nodiscard]] bool is_ancestor(TreeIterator auto ancestor,
+                                 TreeIterator auto descendant)
+  {
+    if (numbering.outdated()) {
+      rebuild();
+    }
+
+    const size_type entry = numbering.position(ancestor.node);
+    const size_type other_entry = numbering.position(descendant.node);
+
+    return entry <= other_entry && other_entry <= exits[entry];
+  }
+
+  //! @brief Checks whether an element precedes another element in pre-order.
+  //!
+  //! @details The comparison is a strict weak ordering of the elements. The
+  //! behavior is undefined if either iterator is not a dereferenceable
+  //! iterator of the indexed container.
+  //!
+  //! @param lhs The iterator to the first element.
+  //! @param rhs The iterator to the second element.
+  //!
+  //! @return `true` if the first element is visited before the second element
+  //! in a pre-order depth-first traversal, `false` otherwise.
+  //!
+  //! @complexity Constant on average. Linear in the size of the container when
+  //! the index is relabeled.
+  [[nodiscard]] bool precedes(TreeIterator auto lhs, TreeIterator auto rhs)
+  {
+    if (numbering.outdated()) {
+      rebuild();
+    }
+
+    return numbering.position(lhs.node) < numbering.position(rhs.node);
+  }
+
+  //! @}
+
+  //! @name Public Modifier Member Functions
+  //! @{
+
+  //! @brief Relabels the index from the container.
+  //!
+  //! @details Queries relabel the index as needed. Relabeling explicitly
+  //! moves the cost of the labeling out of the next query.
+  //!
+  //! @complexity Linear in the size of the container.
+  void rebuild()
+  {
+    numbering.rebuild();
+
+    // The exit of a node is the greatest exit of its children, or itself for
+    // a leaf. Children follow their parent in pre-order and are accumulated in
+    // reverse.
+    const size_type count = numbering.nodes.size();
+    exits.resize(count);
+    for (size_type index = 0; index < count; ++index) {
+      exits[index] = index;
+    }
+    for (size_type index = count; index-- > 1;) {
+      size_type &parent_exit = exits[numbering.parents[index]];
+      parent_exit = std::max(parent_exit, exits[index]);
+    }
+  }
+
+  //! @}
+
+  private:
+  //! @name Private Member Types
+  //! @{
+
+  //! @brief The pre-order numbering type of the indexed container.
+  using numbering_type =
+      internal_pre_order_numbering_type<Type, Allocator, NodePolicy>;
+
+  //! @brief The allocator type of the exit labels.
+  using exit_allocator_type =
+      typename numbering_type::template allocator_type<size_type>;
+
+  //! @}
+
+  //! @name Private Member Variables
+  //! @{
+
+  //! @brief The pre-order numbering of the indexed container, providing the
+  //! entry labels.
+  numbering_type numbering;
+
+  //! @brief The exit labels of the nodes in pre-order.
+  typename numbering_type::template sequence_type<size_type> exits;
+
+  //! @}
+};
+
+//! @brief Heavy-light decomposition index of a tree container.
+//!
+//! @details The index answers aggregate queries of the weights of the elements
+//! along vertical paths, and point updates of the weights, in squared
+//! logarithmic time. The weight of an element is the projection of its value.
+//! The weights are aggregated by a monoid: an associative operation with its
+//! identity element. The operation need not be commutative, the weights are
+//! aggregated from the top to the bottom of the path. The container is
+//! decomposed in heavy paths: the heavy child of a node is its child with the
+//! most descendants. A path from the root crosses at most a logarithmic number
+//! of heavy paths, each heavy path being aggregated by its own segment tree.
+//! The index is built on the first query and rebuilt on the next query
+//! following a modification of the container's topology. Modifications of the
+//! values of the elements are reflected by updating their weights.
+//!
+//! @tparam Type The type template parameter of the contained data in the tree
+//! elements.
+//! @tparam Allocator The type template parameter of the allocator for the nodes
+//! of the tree elements, rebound for the memory of the index.
+//! @tparam Operation The type template parameter of the associative binary
+//! operation aggregating the weights.
+//! @tparam Projection The type template parameter of the projection of the
+//! element values to their weights.
+//! @tparam NodePolicy The type template parameter of the node policy of the
+//! tree.
+template <typename Type, typename Allocator, typename Operation,
+          typename Projection, typename NodePolicy>
+class heavy_light_index
+{
+  public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The type of the indexed container.
+  using container_type = tree<Type, Allocator, NodePolicy>;
+
+  //! @brief The unsigned integer type to represent element counts.
+  using size_type = typename container_type::size_type;
+
+  //! @brief The type of the weights of the elements and of their aggregates.
+  using value_type = std::remove_cvref_t<
+      std::invoke_result_t<Projection &, const Type &>>;
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief Constructs the index of a container.
+  //!
+  //! @details The index is built on the first query. The container must
+  //! outlive the index.
+  //!
+  //! @param container The container to index.
+  //! @param identity The identity element of the operation, the aggregate of
+  //! an empty path.
+  //! @param operation The associative binary operation aggregating the weights.
+  //! @param projection The projection of the element values to their weights.
+  //!
+  //! @complexity Constant.
+  explicit heavy_light_index(const container_type &container,
+                             value_type identity = value_type{},
+                             Operation operation = Operation{},
+                             Projection projection = Projection{})
+          : numbering{ container },
+            identity{ std::move(identity) },
+            operation{ std::move(operation) },
+            projection{ std::move(projection) },
+            heads{ position_allocator_type{ container.get_allocator() } },
+            slots{ position_allocator_type{ container.get_allocator() } },
+            lengths{ position_allocator_type{ container.get_allocator() } },
+            segments{ segment_allocator_type{ container.get_allocator() } }
+  {
+  }
+
+  //! @}
+
+  //! @name Public Search Member Functions
+  //! @{
+
+  //! @brief Aggregates the weights of the path from the root to an element.
+  //!
+  //! @details The path includes both the root and the element. The behavior is
+  //! undefined if the iterator is not a dereferenceable iterator of the indexed
+  //! container.
+  //!
+  //! @param position The iterator to the last element of the path.
+  //!
+  //! @return The aggregate of the weights along the path from the root.
+  //!
+  //! @complexity Squared logarithmic in the size of the container on average.
+  //! Linear in the size of the container when the index is rebuilt.
+  [[nodiscard]] value_type path(TreeIterator auto position)
+  {
+    if (numbering.outdated()) {
+      rebuild();
+    }
+
+    return climb(numbering.position(position.node), numbering.nodes.size());
+  }
+
+  //! @brief Aggregates the weights of the path from an ancestor to one of its
+  //! descendants.
+  //!
+  //! @details The path includes both the ancestor and the descendant. An
+  //! element is an ancestor of itself. The behavior is undefined if either
+  //! iterator is not a dereferenceable iterator of the indexed container, or
+  //! if the first element is not an ancestor of the second element.
+  //!
+  //! @param ancestor The iterator to the first element of the path.
+  //! @param descendant The iterator to the last element of the path.
+  //!
+  //! @return The aggregate of the weights along the path from the ancestor.
+  //!
+  //! @complexity Squared logarithmic in the size of the container on average.
+  //! Linear in the size of the container when the index is rebuilt.
+  [[nodiscard]] value_type path(TreeIterator auto ancestor,
+                                TreeIterator auto descendant)
+  {
+    if (numbering.outdated()) {
+      rebuild();
+    }
+
+    return climb(numbering.position(descendant.node),
+                 numbering.position(ancestor.node));
+  }
+
+  //! @}
+
+  //! @name Public Modifier Member Functions
+  //! @{
+
+  //! @brief Updates the weight of an element from its current value.
+  //!
+  //! @details Call after modifying the value of an element for the following
+  //! queries to aggregate its new weight. The behavior is undefined if the
+  //! iterator is not a dereferenceable iterator of the indexed container.
+  //!
+  //! @param position The iterator to the modified element.
+  //!
+  //! @complexity Logarithmic in the size of the container on average. Linear
+  //! in the size of the container when the index is rebuilt.
+  void update(TreeIterator auto position)
+  {
+    // A rebuild projects the weights of all the elements.
+    if (numbering.outdated()) {
+      rebuild();
+      return;
+    }
+
+    const size_type index = numbering.position(position.node);
+    const size_type head = heads[index];
+    const size_type length = lengths[head];
+    value_type *segment = segments.data() + 2 * slots[head];
+    size_type leaf = length + slots[index] - slots[head];
+    segment[leaf] = std::invoke(projection, position.node->data);
+    for (leaf >>= 1; leaf >= 1; leaf >>= 1) {
+      segment[leaf] =
+          std::invoke(operation, segment[2 * leaf], segment[2 * leaf + 1]);
+    }
+  }
+
+  //! @brief Rebuilds the index from the container.
+  //!
+  //! @details Queries and updates rebuild the index as needed. Rebuilding
+  //! explicitly moves the cost of the construction out of the next query.
+  //!
+  //! @complexity Linear in the size of the container.
+  void rebuild()
+  {
+    numbering.rebuild();
+
+    // The sizes of the subtrees are accumulated in reverse pre-order, the
+    // heavy child of a node is its child with the largest subtree.
+    const size_type count = numbering.nodes.size();
+    const position_allocator_type allocator{
+      numbering.container->get_allocator()
+    };
+    sequence_type<size_type> sizes(count, 1, allocator);
+    sequence_type<size_type> heavy_children(count, count, allocator);
+    for (size_type index = count; index-- > 1;) {
+      const size_type parent = numbering.parents[index];
+      sizes[parent] += sizes[index];
+      if (heavy_children[parent] == count ||
+          sizes[heavy_children[parent]] <= sizes[index]) {
+        heavy_children[parent] = index;
+      }
+    }
+
+    // A head is visited before the rest of its heavy path in pre-order, its
+    // path is laid out contiguously from its slot.
+    heads.assign(count, count);
+    slots.assign(count, 0);
+    lengths.assign(count, 0);
+    size_type slot = 0;
+    for (size_type index = 0; index < count; ++index) {
+      if (heads[index] == count) {
+        for (size_type node = index; node != count;
+             node = heavy_children[node]) {
+          heads[node] = index;
+          slots[node] = slot++;
+          ++lengths[index];
+        }
+      }
+    }
+
+    // The segment tree of a heavy path of `n` nodes has the `n` leaves
+    // following its `n - 1` internal nodes, from twice the slot of its head.
+    segments.assign(2 * count, identity);
+    for (size_type index = 0; index < count; ++index) {
+      const size_type head = heads[index];
+      segments[2 * slots[head] + lengths[head] + slots[index] - slots[head]] =
+          std::invoke(projection, numbering.nodes[index]->data);
+    }
+    for (size_type head = 0; head < count; ++head) {
+      if (heads[head] == head) {
+        value_type *segment = segments.data() + 2 * slots[head];
+        for (size_type internal = lengths[head]; internal-- > 1;) {
+          segment[internal] = std::invoke(operation, segment[2 * internal],
+                                          segment[2 * internal + 1]);
+        }
+      }
+    }
+  }
+
+  //! @}
+
+  private:
+  //! @name Private Member Types
+  //! @{
+
+  //! @brief The pre-order numbering type of the indexed container.
+  using numbering_type =
+      internal_pre_order_numbering_type<Type, Allocator, NodePolicy>;
+
+  //! @brief The type of a sequence of the index.
+  template <typename Value>
+  using sequence_type = typename numbering_type::template sequence_type<Value>;
+
+  //! @brief The allocator type of the positions.
+  using position_allocator_type =
+      typename numbering_type::template allocator_type<size_type>;
+
+  //! @brief The allocator type of the segment trees.
+  using segment_allocator_type =
+      typename numbering_type::template allocator_type<value_type>;
+
+  //! @}
+
+  //! @name Private Member Functions
+  //! @{
+
+  //! @brief Aggregates the weights of a vertical path, from the top.
+  //!
+  //! @param index The pre-order position of the last node of the path.
+  //! @param top The pre-order position of the first node of the path, or the
+  //! size of the container for a path from the root.
+  //!
+  //! @return The aggregate of the weights along the path.
+  //!
+  //! @complexity Squared logarithmic in the size of the container.
+  [[nodiscard]] value_type climb(size_type index, size_type top) const
+  {
+    // The heavy paths are crossed from the bottom, their aggregates are
+    // prepended.
+    const size_type count = numbering.nodes.size();
+    value_type result = identity;
+    while (index != count) {
+      const size_type head = heads[index];
+      const bool last = top != count && heads[top] == head;
+      const size_type first = last ? slots[top] - slots[head] : 0;
+      result = std::invoke(
+          operation, aggregate(head, first, slots[index] - slots[head] + 1),
+          result);
+      index = last ? count : numbering.parents[head];
+    }
+
+    return result;
+  }
+
+  //! @brief Aggregates the weights of a range of a heavy path.
+  //!
+  //! @param head The pre-order position of the head of the heavy path.
+  //! @param first The offset of the first node of the range in the path.
+  //! @param last The offset following the last node of the range in the path.
+  //!
+  //! @return The aggregate of the weights of the range.
+  //!
+  //! @complexity Logarithmic in the length of the heavy path.
+  [[nodiscard]] value_type aggregate(size_type head, size_type first,
+                                     size_type last) const
+  {
+    // The range is narrowed from both ends, keeping the order of the weights.
+    const value_type *segment = segments.data() + 2 * slots[head];
+    value_type left = identity;
+    value_type right = identity;
+    for (first += lengths[head], last += lengths[head]; first < last;
+         first >>= 1, last >>= 1) {
+      if (first & 1) {
+        left = std::invoke(operation, left, segment[first++]);
+      }
+      if (last & 1) {
+        right = std::invoke(operation, segment[--last], right);
+      }
+    }
+
+    return std::invoke(operation, left, right);
+  }
+
+  //! @}
+
+  //! @name Private Member Variables
+  //! @{
+
+  //! @brief The pre-order numbering of the indexed container.
+  numbering_type numbering;
+
+  //! @brief The identity element of the operation.
+  value_type identity;
+
+  //! @brief The associative binary operation aggregating the weights.
+  [[no_unique_address]] Operation operation;
+
+  //! @brief The projection of the element values to their weights.
+  [[no_unique_address]] Projection projection;
+
+  //! @brief The pre-order positions of the heads of the heavy paths of the
+  //! nodes in pre-order.
+  sequence_type<size_type> heads;
+
+  //! @brief The slots of the nodes in pre-order, the heavy paths being laid
+  //! out contiguously.
+  sequence_type<size_type> slots;
+
+  //! @brief The lengths of the heavy paths of the heads in pre-order.
+  sequence_type<size_type> lengths;
+
+  //! @brief The segment trees of the heavy paths, each from twice the slot of
+  //! its head.
+  sequence_type<value_type> segments;
+
+  //! @}
+};
+
+//! @name Deduction Guides
+//! @{
+
+template <typename Type, typename Allocator, typename NodePolicy>
+lowest_common_ancestor_index(const tree<Type, Allocator, NodePolicy> &container)
+    -> lowest_common_ancestor_index<Type, Allocator, NodePolicy>;
+
+template <typename Type, typename Allocator, typename NodePolicy>
+ancestor_index(const tree<Type, Allocator, NodePolicy> &container)
+    -> ancestor_index<Type, Allocator, NodePolicy>;
+
+template <typename Type, typename Allocator, typename NodePolicy>
+interval_index(const tree<Type, Allocator, NodePolicy> &container)
+    -> interval_index<Type, Allocator, NodePolicy>;
+
+template <typename Type, typename Allocator, typename NodePolicy>
+heavy_light_index(const tree<Type, Allocator, NodePolicy> &container)
+    -> heavy_light_index<Type, Allocator, std::plus<>, std::identity,
+                         NodePolicy>;
+
+template <typename Type, typename Allocator, typename NodePolicy,
+          typename Value, typename Operation>
+heavy_light_index(const tree<Type, Allocator, NodePolicy> &container,
+                  Value identity, Operation operation)
+    -> heavy_light_index<Type, Allocator, Operation, std::identity, NodePolicy>;
+
+template <typename Type, typename Allocator, typename NodePolicy,
+          typename Value, typename Operation, typename Projection>
+heavy_light_index(const tree<Type, Allocator, NodePolicy> &container,
+                  Value identity, Operation operation, Projection projection)
+    -> heavy_light_index<Type, Allocator, Operation, Projection, NodePolicy>;
+
+//! @}
+} // namespace fcarouge
+
+#endif // FCAROUGE_TREE_INDEX_HPP
@@ -0,0 +1,79 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+//! @file
+//! @brief Forward companion header for the tree container's index types.
+//!
+//! @details The header forward declares the container's index types and
+//! includes its minimum necessary standard library dependencies. Optionally use
+//! this header when one or more of the library index type declarations are
+//! required but not their definitions. For instance, in project headers to help
+//! in reducing dependencies and compilation times, while the index header would
+//! only be used in the project sources.
+
+#ifndef FCAROUGE_TREE_INDEX_FWD_HPP
+#define FCAROUGE_TREE_INDEX_FWD_HPP
+
+#include <functional>
+// std::identity std::plus
+
+#include "tree_fwd.hpp"
+
+//! @namespace fcarouge Francois Carouge's projects namespace. Lowers the name
+//! conflict probability in large projects. Use using-declarations or
+//! namespace-alias-definition per your project guidelines.
+namespace fcarouge
+{
+//! @name Forward Type Declarations
+//! @{
+
+template <typename Type, typename Allocator,
+          typename NodePolicy = node_policy<>>
+struct internal_pre_order_numbering_type;
+
+template <typename Type, typename Allocator,
+          typename NodePolicy = node_policy<>>
+class lowest_common_ancestor_index;
+
+template <typename Type, typename Allocator,
+          typename NodePolicy = node_policy<>>
+class ancestor_index;
+
+template <typename Type, typename Allocator,
+          typename NodePolicy = node_policy<>>
+class interval_index;
+
+template <typename Type, typename Allocator,
+          typename Operation = std::plus<>, typename Projection = std::identity,
+          typename NodePolicy = node_policy<>>
+class heavy_light_index;
+
+//! @}
+} // namespace fcarouge
+
+#endif // FCAROUGE_TREE_INDEX_FWD_HPP
@@ -36,13 +36,16 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #define FCAROUGE_TREE_ITERATOR_HPP
 
 #include <iterator>
-// std::bidirectional_iterator_tag
+// std::bidirectional_iterator_tag std::forward_iterator_tag
 
 #include <memory>
-// std::pointer_traits
+// std::allocator_traits std::pointer_traits
 
 #include <type_traits>
-// std::remove_pointer_t
+// std::is_constant_evaluated std::remove_pointer_t
+
+#include <utility>
+// std::exchange std::move std::swap
 
 #include "tree_iterator_fwd.hpp"
 
@@ -85,6 +88,9 @@ struct depth_first_pre_order_iterator_type {
   //! iterator.
   using iterator_category = std::bidirectional_iterator_tag;
 
+  //! @brief The container type of the underlying iterator.
+  using container_type = typename Iterator::container_type;
+
   //! @}
 
   //! @name Public Observer Member Functions
@@ -122,13 +128,12 @@ struct depth_first_pre_order_iterator_type {
   //! @brief Prefix increments the iterator.
   //!
   //! @return Reference to the next iterator.
+  //!
+  //! @complexity Constant with the thread node policy, linear in the height
+  //! of the container otherwise.
   constexpr depth_first_pre_order_iterator_type &operator++() noexcept
   {
-    if (node->first_child) {
-      node = node->first_child;
-    } else {
-      node = node->next_ancestor_sibling();
-    }
+    node = node->next();
 
     return *this;
   }
@@ -136,26 +141,31 @@ struct depth_first_pre_order_iterator_type {
   //! @brief Postfix increments the iterator.
   //!
   //! @return Next iterator.
-  [[nodiscard]] constexpr depth_first_pre_order_iterator_type
-  operator++(int) const noexcept
+  constexpr depth_first_pre_order_iterator_type operator++(int) noexcept
   {
     depth_first_pre_order_iterator_type temporary_iterator = *this;
-    if (node->first_child) {
-      node = node->first_child;
-    } else {
-      node = node->next_ancestor_sibling();
-    }
+    ++*this;
 
     return temporary_iterator;
   }
 
   //! @brief Prefix decrements the iterator.
   //!
+  //! @details The previous node is the last descendant of the left sibling if
+  //! any, found by descending the last children, or the parent otherwise. The
+  //! previous node of the ending iterator is the last descendant of the root,
+  //! the ending iterator must then know the root of the container such as the
+  //! ending iterator of the reverse beginning `rbegin()`.
+  //!
   //! @return Reference to the previous iterator.
+  //!
+  //! @complexity Amortized constant.
   constexpr depth_first_pre_order_iterator_type &operator--() noexcept
   {
-    if (node->left_sibling) {
-      node = node->left_sibling;
+    if (!node) {
+      node = last_descendant(root);
+    } else if (node->left_sibling) {
+      node = last_descendant(node->left_sibling);
     } else {
       node = node->parent;
     }
@@ -166,19 +176,33 @@ struct depth_first_pre_order_iterator_type {
   //! @brief Postfix decrements the iterator.
   //!
   //! @return Previous iterator.
-  [[nodiscard]] constexpr depth_first_pre_order_iterator_type
-  operator--(int) const noexcept
+  //!
+  //! @complexity Amortized constant.
+  constexpr depth_first_pre_order_iterator_type operator--(int) noexcept
   {
     depth_first_pre_order_iterator_type temporary_iterator = *this;
-    if (node->left_sibling) {
-      node = node->left_sibling;
-    } else {
-      node = node->parent;
-    }
+    --*this;
 
     return temporary_iterator;
   }
 
+  //! @brief Skips the descendants of the iterated element.
+  //!
+  //! @details Advances the iterator to the element following the subtree of
+  //! the iterated element in pre-order, pruning the remaining descendants from
+  //! the traversal. Within a subtree range, the iterator never skips past the
+  //! end of the range.
+  //!
+  //! @return Reference to the next iterator following the subtree.
+  //!
+  //! @complexity Linear in the depth of the element.
+  constexpr depth_first_pre_order_iterator_type &skip_subtree() noexcept
+  {
+    node = node->next_ancestor_sibling();
+
+    return *this;
+  }
+
   //! @}
 
   //! @name Public Conversion Function
@@ -244,20 +268,1997 @@ struct depth_first_pre_order_iterator_type {
 
   //! @}
 
+  //! @name Internal Implementation Member Functions
+  //! @{
+
+  //! @brief Finds the last node of a subtree in pre-order.
+  //!
+  //! @param subtree The root node of the subtree, or `nullptr`.
+  //!
+  //! @return The deepest last descendant node of the subtree, itself if it has
+  //! no children; or `nullptr` if the subtree is empty.
+  //!
+  //! @complexity Linear in the height of the subtree.
+  [[nodiscard]] static constexpr internal_node_type *
+  last_descendant(internal_node_type *subtree) noexcept
+  {
+    if (subtree) {
+      while (subtree->last_child) {
+        subtree = subtree->last_child;
+      }
+    }
+
+    return subtree;
+  }
+
+  //! @}
+
   //! @name Internal Implementation Member Variables
   //! @{
 
   //! @brief The internal pointer to the node represented by the iterator.
   internal_node_type *node = nullptr;
 
+  //! @brief The internal pointer to the root node of the container or of the
+  //! subtree range, to decrement the ending iterator, or `nullptr` if unknown.
+  internal_node_type *root = nullptr;
+
   //! @}
 };
 
-//! @name Deduction Guides
-//! @{
+//! @brief A pre-order depth-first tree traversal iterator with software
+//! prefetching.
+//!
+//! @details Type to identify and traverse the elements of the container in the
+//! same order as the depth-first pre-order iterator. On every step, the first
+//! child and the right sibling of the iterated element are prefetched: they
+//! are the next element, and the element following its subtree. The
+//! independent loads overlap the latency of the pointer chase on large
+//! containers whose nodes are scattered in memory.
+//!
+//! @tparam Iterator The underlying tree member iterator type-constraint
+//! template parameter providing constness and conversion support.
+template <TreeMemberIterator Iterator>
+struct depth_first_pre_order_prefetch_iterator_type {
+  //! @name Public Member Types
+  //! @{
 
-depth_first_pre_order_iterator_type(TreeMemberIterator auto position)
-    -> depth_first_pre_order_iterator_type<decltype(position)>;
+  //! @brief The type of the contained data elements.
+  using value_type = typename Iterator::value_type;
+
+  //! @brief Signed integer type to represent element distances.
+  using difference_type = typename Iterator::difference_type;
+
+  //! @brief The reference type of the contained data elements.
+  using reference = typename Iterator::reference;
+
+  //! @brief The pointer type of the contained data elements.
+  using pointer = typename Iterator::pointer;
+
+  //! @brief The LegacyForwardIterator requirements category of the iterator.
+  using iterator_category = std::forward_iterator_tag;
+
+  //! @brief The container type of the underlying iterator.
+  using container_type = typename Iterator::container_type;
+
+  //! @}
+
+  //! @name Public Observer Member Functions
+  //! @{
+
+  //! @brief Accesses the stored element data.
+  //!
+  //! @details Indirection operator. Dereferences the iterator to obtain the
+  //! container's stored value. The behavior is undefined if the iterator is
+  //! invalid.
+  //!
+  //! @return Reference to the element if the iterator is dereferencable.
+  [[nodiscard]] constexpr reference operator*() const noexcept
+  {
+    return node->data;
+  }
+
+  //! @brief Points to the stored element.
+  //!
+  //! @details Member access operator. Dereferenceable pointer or pointer-like
+  //! object of the container's stored value from this iterator. The behavior
+  //! is undefined if the iterator is invalid.
+  //!
+  //! @return Pointer to the element if the iterator is dereferencable.
+  [[nodiscard]] constexpr pointer operator->() const noexcept
+  {
+    return std::pointer_traits<pointer>::pointer_to(node->data);
+  }
+
+  //! @}
+
+  //! @name Public Modifier Member Functions
+  //! @{
+
+  //! @brief Prefix increments the iterator.
+  //!
+  //! @details Advances to the pre-order successor and prefetches its first
+  //! child and right sibling.
+  //!
+  //! @return Reference to the next iterator.
+  //!
+  //! @complexity Constant with the thread node policy, linear in the height
+  //! of the container otherwise.
+  constexpr depth_first_pre_order_prefetch_iterator_type &operator++() noexcept
+  {
+    node = node->next();
+    if (node) {
+      prefetch(node->first_child);
+      prefetch(node->right_sibling);
+    }
+
+    return *this;
+  }
+
+  //! @brief Postfix increments the iterator.
+  //!
+  //! @return Next iterator.
+  //!
+  //! @complexity Constant with the thread node policy, linear in the height
+  //! of the container otherwise.
+  constexpr depth_first_pre_order_prefetch_iterator_type
+  operator++(int) noexcept
+  {
+    depth_first_pre_order_prefetch_iterator_type temporary_iterator = *this;
+    ++*this;
+
+    return temporary_iterator;
+  }
+
+  //! @}
+
+  //! @name Public Conversion Function
+  //! @{
+
+  //! @brief Converts to tree non-constant container iterators.
+  //!
+  //! @details Allows conversion accross tree non-constant container
+  //! iterators.
+  //!
+  //! @tparam OtherIterator The tree non-constant container iterator
+  //! type-constraint template parameter to convert this iterator to.
+  //!
+  //! @return The converted tree non-constant container iterator.
+  template <TreeIterator OtherIterator>
+  operator OtherIterator() const &requires TreeNonConstIterator<Iterator>
+  {
+    return OtherIterator{ node };
+  }
+
+  //! @brief Converts to tree constant container iterators.
+  //!
+  //! @details Allows conversion to constant container iterators.
+  //!
+  //! @tparam OtherIterator The tree constant container iterator
+  //! type-constraint template parameter to convert this iterator to.
+  //!
+  //! @return The converted tree constant container iterator.
+  template <TreeConstIterator OtherIterator>
+  operator OtherIterator() const &requires TreeConstIterator<Iterator>
+  {
+    return OtherIterator{ node };
+  }
+
+  //! @}
+
+  //! @name Public Comparison Function
+  //! @{
+
+  //! @brief Compares the iterators.
+  //!
+  //! @details Checks if the iterators point to the same element.
+  //!
+  //! @param other The iterator to evaluate.
+  //!
+  //! @return `true` if the iterators point to the same element, `false`
+  //! otherwise.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] constexpr bool
+  operator==(const depth_first_pre_order_prefetch_iterator_type<Iterator>
+                 &other) const noexcept
+  {
+    return node == other.node;
+  }
+
+  //! @}
+
+  //! @name Internal Implementation Member Types
+  //! @{
+
+  //! @brief The internal node data structure type containing the element data.
+  using internal_node_type = std::remove_pointer_t<decltype(Iterator::node)>;
+
+  //! @}
+
+  //! @name Internal Implementation Member Functions
+  //! @{
+
+  //! @brief Hints the processor to fetch a node into the cache.
+  //!
+  //! @details The hint is a no-op in constant evaluation, on compilers without
+  //! a prefetch intrinsic, or for a null node.
+  //!
+  //! @param node The node to prefetch, or `nullptr`.
+  static constexpr void prefetch(const internal_node_type *node) noexcept
+  {
+    if (!std::is_constant_evaluated()) {
+#if defined(__GNUC__) || defined(__clang__)
+      __builtin_prefetch(node);
+#else
+      static_cast<void>(node);
+#endif
+    }
+  }
+
+  //! @}
+
+  //! @name Internal Implementation Member Variables
+  //! @{
+
+  //! @brief The internal pointer to the node represented by the iterator.
+  internal_node_type *node = nullptr;
+
+  //! @}
+};
+
+//! @brief A post-order depth-first tree traversal iterator.
+//!
+//! @details Type to identify and traverse the elements of the container. The
+//! iteration order is specified as a post-order depth-first traversal. Each
+//! element is visited only once, after all of its descendants. The traversal
+//! follows the existing links of the nodes and requires no auxiliary stack.
+//! -# Traverse the left-most child node and data.
+//! -# Traverse the next child node and data.
+//! -# Current node data.
+//!
+//! @tparam Iterator The underlying tree member iterator type-constraint
+//! template parameter providing constness and conversion support.
+template <TreeMemberIterator Iterator>
+struct depth_first_post_order_iterator_type {
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The type of the contained data elements.
+  using value_type = typename Iterator::value_type;
+
+  //! @brief Signed integer type to represent element distances.
+  using difference_type = typename Iterator::difference_type;
+
+  //! @brief The reference type of the contained data elements.
+  using reference = typename Iterator::reference;
+
+  //! @brief The pointer type of the contained data elements.
+  using pointer = typename Iterator::pointer;
+
+  //! @brief The LegacyForwardIterator requirements category of the iterator.
+  using iterator_category = std::forward_iterator_tag;
+
+  //! @brief The container type of the underlying iterator.
+  using container_type = typename Iterator::container_type;
+
+  //! @}
+
+  //! @name Public Observer Member Functions
+  //! @{
+
+  //! @brief Accesses the stored element data.
+  //!
+  //! @details Indirection operator. Dereferences the iterator to obtain the
+  //! container's stored value. The behavior is undefined if the iterator is
+  //! invalid.
+  //!
+  //! @return Reference to the element if the iterator is dereferencable.
+  [[nodiscard]] constexpr reference operator*() const noexcept
+  {
+    return node->data;
+  }
+
+  //! @brief Points to the stored element.
+  //!
+  //! @details Member access operator. Dereferenceable pointer or pointer-like
+  //! object of the container's stored value from this iterator. The behavior
+  //! is undefined if the iterator is invalid.
+  //!
+  //! @return Pointer to the container's stored value iterator.
+  [[nodiscard]] constexpr pointer operator->() const noexcept
+  {
+    return std::pointer_traits<pointer>::pointer_to(node->data);
+  }
+
+  //! @}
+
+  //! @name Public Modifier Member Functions
+  //! @{
+
+  //! @brief Prefix increments the iterator.
+  //!
+  //! @details The next node is the first leaf of the right sibling subtree if
+  //! any, or the parent otherwise. Every link is followed at most twice over a
+  //! full traversal.
+  //!
+  //! @return Reference to the next iterator.
+  //!
+  //! @complexity Amortized constant.
+  constexpr depth_first_post_order_iterator_type &operator++() noexcept
+  {
+    if (node->right_sibling) {
+      node = first_leaf(node->right_sibling);
+    } else {
+      node = node->parent;
+    }
+
+    return *this;
+  }
+
+  //! @brief Postfix increments the iterator.
+  //!
+  //! @return Next iterator.
+  //!
+  //! @complexity Amortized constant.
+  constexpr depth_first_post_order_iterator_type operator++(int) noexcept
+  {
+    depth_first_post_order_iterator_type temporary_iterator = *this;
+    ++*this;
+
+    return temporary_iterator;
+  }
+
+  //! @}
+
+  //! @name Public Conversion Function
+  //! @{
+
+  //! @brief Converts to tree non-constant container iterators.
+  //!
+  //! @details Allows conversion accross tree non-constant container
+  //! iterators.
+  //!
+  //! @tparam OtherIterator The tree non-constant container iterator
+  //! type-constraint template parameter to convert this iterator to.
+  //!
+  //! @return The converted tree non-constant container iterator.
+  template <TreeIterator OtherIterator>
+  operator OtherIterator() const &requires TreeNonConstIterator<Iterator>
+  {
+    return OtherIterator{ node };
+  }
+
+  //! @brief Converts to tree constant container iterators.
+  //!
+  //! @details Allows conversion to constant container iterators.
+  //!
+  //! @tparam OtherIterator The tree constant container iterator
+  //! type-constraint template parameter to convert this iterator to.
+  //!
+  //! @return The converted tree constant container iterator.
+  template <TreeConstIterator OtherIterator>
+  operator OtherIterator() const &requires TreeConstIterator<Iterator>
+  {
+    return OtherIterator{ node };
+  }
+
+  //! @}
+
+  //! @name Public Comparison Function
+  //! @{
+
+  //! @brief Compares the iterators.
+  //!
+  //! @details Checks if the iterators point to the same element.
+  //!
+  //! @param other The iterator to evaluate.
+  //!
+  //! @return `true` if the iterators point to the same element, `false`
+  //! otherwise.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] constexpr bool operator==(
+      const depth_first_post_order_iterator_type<Iterator> &other)
+      const noexcept
+  {
+    return node == other.node;
+  }
+
+  //! @}
+
+  //! @name Internal Implementation Member Types
+  //! @{
+
+  //! @brief The internal node data structure type containing the element data.
+  using internal_node_type = std::remove_pointer_t<decltype(Iterator::node)>;
+
+  //! @}
+
+  //! @name Internal Implementation Member Functions
+  //! @{
+
+  //! @brief Finds the first node of a subtree in post-order.
+  //!
+  //! @param subtree The root node of the subtree, or `nullptr`.
+  //!
+  //! @return The left-most leaf node of the subtree; or `nullptr` if the
+  //! subtree is empty.
+  //!
+  //! @complexity Linear in the height of the subtree.
+  [[nodiscard]] static constexpr internal_node_type *
+  first_leaf(internal_node_type *subtree) noexcept
+  {
+    if (subtree) {
+      while (subtree->first_child) {
+        subtree = subtree->first_child;
+      }
+    }
+
+    return subtree;
+  }
+
+  //! @}
+
+  //! @name Internal Implementation Member Variables
+  //! @{
+
+  //! @brief The internal pointer to the node represented by the iterator.
+  internal_node_type *node = nullptr;
+
+  //! @}
+};
+
+//! @brief A pre-order depth-first tree traversal iterator tracking the depth.
+//!
+//! @details Type to identify and traverse the elements of the container in the
+//! same pre-order depth-first order as the `depth_first_pre_order_iterator`.
+//! The iterator maintains the depth of the iterated node incrementally while it
+//! descends to children and climbs back to ancestors siblings. Observing the
+//! depth of each node in a traversal is then constant instead of linear in the
+//! depth of the node.
+//!
+//! @tparam Iterator The underlying tree member iterator type-constraint
+//! template parameter providing constness and conversion support.
+template <TreeMemberIterator Iterator> struct depth_aware_iterator_type {
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The type of the contained data elements.
+  using value_type = typename Iterator::value_type;
+
+  //! @brief Signed integer type to represent element distances.
+  using difference_type = typename Iterator::difference_type;
+
+  //! @brief The reference type of the contained data elements.
+  using reference = typename Iterator::reference;
+
+  //! @brief The pointer type of the contained data elements.
+  using pointer = typename Iterator::pointer;
+
+  //! @brief The LegacyForwardIterator requirements category of the iterator.
+  using iterator_category = std::forward_iterator_tag;
+
+  //! @brief The container type of the underlying iterator.
+  using container_type = typename Iterator::container_type;
+
+  //! @brief The internal node data structure type containing the element data.
+  using internal_node_type = std::remove_pointer_t<decltype(Iterator::node)>;
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief Constructs an ending iterator.
+  //!
+  //! @complexity Constant.
+  constexpr depth_aware_iterator_type() noexcept = default;
+
+  //! @brief Constructs the iterator at the given node.
+  //!
+  //! @details The depth of the node is measured once by walking its ancestors.
+  //!
+  //! @param position The node to iterate from, or `nullptr` for the ending
+  //! iterator.
+  //!
+  //! @complexity Linear in the depth of the node.
+  constexpr depth_aware_iterator_type(internal_node_type *position) noexcept
+          : node{ position }
+  {
+    if (node) {
+      for (const internal_node_type *ancestor = node->parent; ancestor;
+           ancestor = ancestor->parent) {
+        ++level;
+      }
+    }
+  }
+
+  //! @}
+
+  //! @name Public Observer Member Functions
+  //! @{
+
+  //! @brief Accesses the stored element data.
+  //!
+  //! @details Indirection operator. Dereferences the iterator to obtain the
+  //! container's stored value. The behavior is undefined if the iterator is
+  //! invalid.
+  //!
+  //! @return Reference to the element if the iterator is dereferencable.
+  [[nodiscard]] constexpr reference operator*() const noexcept
+  {
+    return node->data;
+  }
+
+  //! @brief Points to the stored element.
+  //!
+  //! @details Member access operator. Dereferenceable pointer or pointer-like
+  //! object of the container's stored value from this iterator. The behavior
+  //! is undefined if the iterator is invalid.
+  //!
+  //! @return Pointer to the container's stored value iterator.
+  [[nodiscard]] constexpr pointer operator->() const noexcept
+  {
+    return std::pointer_traits<pointer>::pointer_to(node->data);
+  }
+
+  //! @}
+
+  //! @name Public Modifier Member Functions
+  //! @{
+
+  //! @brief Prefix increments the iterator.
+  //!
+  //! @details Descending to the first child increments the depth, climbing to
+  //! an ancestor decrements the depth by one for each ancestor walked.
+  //!
+  //! @return Reference to the next iterator.
+  //!
+  //! @complexity Amortized constant.
+  constexpr depth_aware_iterator_type &operator++() noexcept
+  {
+    if (node->first_child) {
+      node = node->first_child;
+      ++level;
+    } else {
+      while (node) {
+        if (node->right_sibling) {
+          node = node->right_sibling;
+          break;
+        }
+        node = node->parent;
+        --level;
+      }
+    }
+
+    return *this;
+  }
+
+  //! @brief Postfix increments the iterator.
+  //!
+  //! @return Next iterator.
+  //!
+  //! @complexity Amortized constant.
+  constexpr depth_aware_iterator_type operator++(int) noexcept
+  {
+    depth_aware_iterator_type temporary_iterator = *this;
+    ++*this;
+
+    return temporary_iterator;
+  }
+
+  //! @}
+
+  //! @name Public Conversion Function
+  //! @{
+
+  //! @brief Converts to tree non-constant container iterators.
+  //!
+  //! @details Allows conversion accross tree non-constant container
+  //! iterators.
+  //!
+  //! @tparam OtherIterator The tree non-constant container iterator
+  //! type-constraint template parameter to convert this iterator to.
+  //!
+  //! @return The converted tree non-constant container iterator.
+  template <TreeIterator OtherIterator>
+  operator OtherIterator() const &requires TreeNonConstIterator<Iterator>
+  {
+    return OtherIterator{ node };
+  }
+
+  //! @brief Converts to tree constant container iterators.
+  //!
+  //! @details Allows conversion to constant container iterators.
+  //!
+  //! @tparam OtherIterator The tree constant container iterator
+  //! type-constraint template parameter to convert this iterator to.
+  //!
+  //! @return The converted tree constant container iterator.
+  template <TreeConstIterator OtherIterator>
+  operator OtherIterator() const &requires TreeConstIterator<Iterator>
+  {
+    return OtherIterator{ node };
+  }
+
+  //! @}
+
+  //! @name Public Comparison Function
+  //! @{
+
+  //! @brief Compares the iterators.
+  //!
+  //! @details Checks if the iterators point to the same element.
+  //!
+  //! @param other The iterator to evaluate.
+  //!
+  //! @return `true` if the iterators point to the same element, `false`
+  //! otherwise.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] constexpr bool
+  operator==(const depth_aware_iterator_type<Iterator> &other) const noexcept
+  {
+    return node == other.node;
+  }
+
+  //! @}
+
+  //! @name Internal Implementation Member Variables
+  //! @{
+
+  //! @brief The internal pointer to the node represented by the iterator.
+  internal_node_type *node = nullptr;
+
+  //! @brief The depth of the node represented by the iterator.
+  difference_type level = 0;
+
+  //! @}
+};
+
+//! @brief A breadth-first tree traversal iterator.
+//!
+//! @details Type to identify and traverse the elements of the container. The
+//! iteration order is specified as a breadth-first, level-order traversal.
+//! Each element is visited only once, after all of the elements of the
+//! shallower levels. The siblings of a family are contiguous in level-order
+//! and are traversed through their links. The frontier only records the first
+//! child of each of the visited families, in a ring buffer allocated from the
+//! container's allocator and grown geometrically.
+//! -# Current level nodes data, from left to right.
+//! -# Next level nodes data, from left to right.
+//!
+//! @tparam Iterator The underlying tree member iterator type-constraint
+//! template parameter providing constness and conversion support.
+//! @tparam Allocator The allocator type template parameter of the container,
+//! rebound for the memory of the frontier.
+template <TreeMemberIterator Iterator, typename Allocator>
+class breadth_first_iterator_type
+{
+  public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The type of the contained data elements.
+  using value_type = typename Iterator::value_type;
+
+  //! @brief Signed integer type to represent element distances.
+  using difference_type = typename Iterator::difference_type;
+
+  //! @brief The reference type of the contained data elements.
+  using reference = typename Iterator::reference;
+
+  //! @brief The pointer type of the contained data elements.
+  using pointer = typename Iterator::pointer;
+
+  //! @brief The LegacyForwardIterator requirements category of the iterator.
+  using iterator_category = std::forward_iterator_tag;
+
+  //! @brief The container type of the underlying iterator.
+  using container_type = typename Iterator::container_type;
+
+  //! @brief The internal node data structure type containing the element data.
+  using internal_node_type = std::remove_pointer_t<decltype(Iterator::node)>;
+
+  //! @brief The allocator type of the frontier.
+  using allocator_type = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<internal_node_type *>;
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief Constructs an ending iterator.
+  //!
+  //! @complexity Constant.
+  constexpr breadth_first_iterator_type() noexcept(
+      noexcept(allocator_type{})) = default;
+
+  //! @brief Constructs the iterator at the root node of the container.
+  //!
+  //! @param root The root node to traverse from, or `nullptr` for the ending
+  //! iterator.
+  //! @param allocator The allocator of the container, rebound for the memory
+  //! of the frontier.
+  //!
+  //! @complexity Constant.
+  constexpr breadth_first_iterator_type(internal_node_type *root,
+                                        const Allocator &allocator) noexcept
+          : node{ root }, allocator{ allocator }
+  {
+  }
+
+  //! @brief Constructs the iterator with the copy of the frontier of another
+  //! iterator.
+  //!
+  //! @param other The other iterator to copy.
+  //!
+  //! @complexity Linear in the size of the frontier.
+  constexpr breadth_first_iterator_type(
+      const breadth_first_iterator_type &other)
+          : node{ other.node },
+            allocator{ allocator_traits::select_on_container_copy_construction(
+                other.allocator) }
+  {
+    reserve(other.count);
+    for (size_type index = 0; index < other.count; ++index) {
+      frontier[index] = other.frontier[(other.head + index) & other.mask()];
+    }
+    count = other.count;
+  }
+
+  //! @brief Constructs the iterator with the frontier of another iterator.
+  //!
+  //! @param other The other iterator to move.
+  //!
+  //! @complexity Constant.
+  constexpr breadth_first_iterator_type(
+      breadth_first_iterator_type &&other) noexcept
+          : node{ std::exchange(other.node, nullptr) },
+            allocator{ std::move(other.allocator) },
+            frontier{ std::exchange(other.frontier, nullptr) },
+            capacity{ std::exchange(other.capacity, 0) },
+            head{ std::exchange(other.head, 0) },
+            count{ std::exchange(other.count, 0) }
+  {
+  }
+
+  //! @brief Destructs the iterator and its frontier.
+  //!
+  //! @complexity Constant.
+  constexpr ~breadth_first_iterator_type() noexcept
+  {
+    if (frontier) {
+      allocator_traits::deallocate(allocator, frontier, capacity);
+    }
+  }
+
+  //! @brief Assigns the copy of another iterator.
+  //!
+  //! @param other The other iterator to copy.
+  //!
+  //! @return The reference to this iterator.
+  //!
+  //! @complexity Linear in the size of the frontier.
+  constexpr breadth_first_iterator_type &
+  operator=(const breadth_first_iterator_type &other)
+  {
+    if (this != &other) {
+      breadth_first_iterator_type copy{ other };
+      swap(copy);
+    }
+
+    return *this;
+  }
+
+  //! @brief Assigns another iterator.
+  //!
+  //! @param other The other iterator to move.
+  //!
+  //! @return The reference to this iterator.
+  //!
+  //! @complexity Constant.
+  constexpr breadth_first_iterator_type &
+  operator=(breadth_first_iterator_type &&other) noexcept
+  {
+    breadth_first_iterator_type moved{ std::move(other) };
+    swap(moved);
+
+    return *this;
+  }
+
+  //! @}
+
+  //! @name Public Observer Member Functions
+  //! @{
+
+  //! @brief Accesses the stored element data.
+  //!
+  //! @details Indirection operator. Dereferences the iterator to obtain the
+  //! container's stored value. The behavior is undefined if the iterator is
+  //! invalid.
+  //!
+  //! @return Reference to the element if the iterator is dereferencable.
+  [[nodiscard]] constexpr reference operator*() const noexcept
+  {
+    return node->data;
+  }
+
+  //! @brief Points to the stored element.
+  //!
+  //! @details Member access operator. Dereferenceable pointer or pointer-like
+  //! object of the container's stored value from this iterator. The behavior
+  //! is undefined if the iterator is invalid.
+  //!
+  //! @return Pointer to the container's stored value iterator.
+  [[nodiscard]] constexpr pointer operator->() const noexcept
+  {
+    return std::pointer_traits<pointer>::pointer_to(node->data);
+  }
+
+  //! @}
+
+  //! @name Public Modifier Member Functions
+  //! @{
+
+  //! @brief Prefix increments the iterator.
+  //!
+  //! @details The family of the node is recorded in the frontier. The next
+  //! node is the right sibling if any, or the first child of the oldest family
+  //! of the frontier otherwise.
+  //!
+  //! @return Reference to the next iterator.
+  //!
+  //! @complexity Amortized constant.
+  constexpr breadth_first_iterator_type &operator++()
+  {
+    if (node->first_child) {
+      push(node->first_child);
+    }
+    if (node->right_sibling) {
+      node = node->right_sibling;
+    } else {
+      node = pop();
+    }
+
+    return *this;
+  }
+
+  //! @brief Postfix increments the iterator.
+  //!
+  //! @return Next iterator.
+  //!
+  //! @complexity Linear in the size of the frontier.
+  constexpr breadth_first_iterator_type operator++(int)
+  {
+    breadth_first_iterator_type temporary_iterator = *this;
+    ++*this;
+
+    return temporary_iterator;
+  }
+
+  //! @brief Exchanges the contents of the iterator with those of the other
+  //! iterator.
+  //!
+  //! @param other The other iterator to exchange the contents with.
+  //!
+  //! @complexity Constant.
+  constexpr void swap(breadth_first_iterator_type &other) noexcept
+  {
+    using std::swap;
+    swap(node, other.node);
+    swap(allocator, other.allocator);
+    swap(frontier, other.frontier);
+    swap(capacity, other.capacity);
+    swap(head, other.head);
+    swap(count, other.count);
+  }
+
+  //! @}
+
+  //! @name Public Conversion Function
+  //! @{
+
+  //! @brief Converts to tree non-constant container iterators.
+  //!
+  //! @details Allows conversion accross tree non-constant container
+  //! iterators.
+  //!
+  //! @tparam OtherIterator The tree non-constant container iterator
+  //! type-constraint template parameter to convert this iterator to.
+  //!
+  //! @return The converted tree non-constant container iterator.
+  template <TreeIterator OtherIterator>
+  operator OtherIterator() const &requires TreeNonConstIterator<Iterator>
+  {
+    return OtherIterator{ node };
+  }
+
+  //! @brief Converts to tree constant container iterators.
+  //!
+  //! @details Allows conversion to constant container iterators.
+  //!
+  //! @tparam OtherIterator The tree constant container iterator
+  //! type-constraint template parameter to convert this iterator to.
+  //!
+  //! @return The converted tree constant container iterator.
+  template <TreeConstIterator OtherIterator>
+  operator OtherIterator() const &requires TreeConstIterator<Iterator>
+  {
+    return OtherIterator{ node };
+  }
+
+  //! @}
+
+  //! @name Public Comparison Function
+  //! @{
+
+  //! @brief Compares the iterators.
+  //!
+  //! @details Checks if the iterators point to the same element.
+  //!
+  //! @param other The iterator to evaluate.
+  //!
+  //! @return `true` if the iterators point to the same element, `false`
+  //! otherwise.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] constexpr bool
+  operator==(const breadth_first_iterator_type &other) const noexcept
+  {
+    return node == other.node;
+  }
+
+  //! @}
+
+  //! @name Internal Implementation Member Variables
+  //! @{
+
+  //! @brief The internal pointer to the node represented by the iterator.
+  internal_node_type *node = nullptr;
+
+  //! @}
+
+  private:
+  //! @name Private Member Types
+  //! @{
+
+  //! @brief The allocator traits type of the frontier.
+  using allocator_traits = std::allocator_traits<allocator_type>;
+
+  //! @brief The unsigned integer type of the frontier counts.
+  using size_type = typename allocator_traits::size_type;
+
+  //! @}
+
+  //! @name Private Member Functions
+  //! @{
+
+  //! @brief Returns the mask of the ring buffer positions.
+  //!
+  //! @return The capacity minus one, the capacity being a power of two.
+  [[nodiscard]] constexpr size_type mask() const noexcept
+  {
+    return capacity - 1;
+  }
+
+  //! @brief Grows the ring buffer to hold at least the requested number of
+  //! families, unrolling its content from the beginning.
+  //!
+  //! @param requested The requested capacity.
+  //!
+  //! @complexity Linear in the size of the frontier.
+  constexpr void reserve(size_type requested)
+  {
+    if (requested <= capacity) {
+      return;
+    }
+
+    size_type grown = capacity ? capacity : minimum_capacity;
+    while (grown < requested) {
+      grown *= 2;
+    }
+    internal_node_type **grown_frontier =
+        allocator_traits::allocate(allocator, grown);
+    for (size_type index = 0; index < count; ++index) {
+      grown_frontier[index] = frontier[(head + index) & mask()];
+    }
+    if (frontier) {
+      allocator_traits::deallocate(allocator, frontier, capacity);
+    }
+    frontier = grown_frontier;
+    capacity = grown;
+    head = 0;
+  }
+
+  //! @brief Records the first child of a family at the back of the frontier.
+  //!
+  //! @param first_child The first child node of the family.
+  //!
+  //! @complexity Amortized constant.
+  constexpr void push(internal_node_type *first_child)
+  {
+    reserve(count + 1);
+    frontier[(head + count) & mask()] = first_child;
+    ++count;
+  }
+
+  //! @brief Removes the oldest family from the front of the frontier.
+  //!
+  //! @return The first child node of the oldest family, or `nullptr` if the
+  //! frontier is empty.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] constexpr internal_node_type *pop() noexcept
+  {
+    if (!count) {
+      return nullptr;
+    }
+
+    internal_node_type *first_child = frontier[head];
+    head = (head + 1) & mask();
+    --count;
+
+    return first_child;
+  }
+
+  //! @}
+
+  //! @name Private Member Constants
+  //! @{
+
+  //! @brief The capacity of the first allocation of the frontier.
+  static constexpr size_type minimum_capacity = 8;
+
+  //! @}
+
+  //! @name Private Member Variables
+  //! @{
+
+  //! @brief The allocator of the frontier.
+  [[no_unique_address]] allocator_type allocator;
+
+  //! @brief The ring buffer of the first children of the families to visit.
+  internal_node_type **frontier = nullptr;
+
+  //! @brief The capacity of the ring buffer, a power of two.
+  size_type capacity = 0;
+
+  //! @brief The position of the oldest family in the ring buffer.
+  size_type head = 0;
+
+  //! @brief The number of families in the ring buffer.
+  size_type count = 0;
+
+  //! @}
+};
+
+//! @brief A level tree traversal iterator.
+//!
+//! @details Type to identify and traverse the elements of one level of the
+//! container, from left to right. The next element is the right sibling if
+//! any, or the first cousin found by climbing to the nearest ancestor with a
+//! right sibling and descending back to the level. The ancestors are only
+//! walked when a family is exhausted.
+//!
+//! @tparam Iterator The underlying tree member iterator type-constraint
+//! template parameter providing constness and conversion support.
+template <TreeMemberIterator Iterator> struct level_iterator_type {
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The type of the contained data elements.
+  using value_type = typename Iterator::value_type;
+
+  //! @brief Signed integer type to represent element distances.
+  using difference_type = typename Iterator::difference_type;
+
+  //! @brief The reference type of the contained data elements.
+  using reference = typename Iterator::reference;
+
+  //! @brief The pointer type of the contained data elements.
+  using pointer = typename Iterator::pointer;
+
+  //! @brief The LegacyForwardIterator requirements category of the iterator.
+  using iterator_category = std::forward_iterator_tag;
+
+  //! @brief The container type of the underlying iterator.
+  using container_type = typename Iterator::container_type;
+
+  //! @}
+
+  //! @name Public Observer Member Functions
+  //! @{
+
+  //! @brief Accesses the stored element data.
+  //!
+  //! @details Indirection operator. Dereferences the iterator to obtain the
+  //! container's stored value. The behavior is undefined if the iterator is
+  //! invalid.
+  //!
+  //! @return Reference to the element if the iterator is dereferencable.
+  [[nodiscard]] constexpr reference operator*() const noexcept
+  {
+    return node->data;
+  }
+
+  //! @brief Points to the stored element.
+  //!
+  //! @details Member access operator. Dereferenceable pointer or pointer-like
+  //! object of the container's stored value from this iterator. The behavior
+  //! is undefined if the iterator is invalid.
+  //!
+  //! @return Pointer to the container's stored value iterator.
+  [[nodiscard]] constexpr pointer operator->() const noexcept
+  {
+    return std::pointer_traits<pointer>::pointer_to(node->data);
+  }
+
+  //! @}
+
+  //! @name Public Modifier Member Functions
+  //! @{
+
+  //! @brief Prefix increments the iterator.
+  //!
+  //! @return Reference to the next iterator.
+  //!
+  //! @complexity Amortized constant over the traversal of a level, linear in
+  //! the size of the shallower levels at worst.
+  constexpr level_iterator_type &operator++() noexcept
+  {
+    node = descend(node, 0);
+
+    return *this;
+  }
+
+  //! @brief Postfix increments the iterator.
+  //!
+  //! @return Next iterator.
+  constexpr level_iterator_type operator++(int) noexcept
+  {
+    level_iterator_type temporary_iterator = *this;
+    ++*this;
+
+    return temporary_iterator;
+  }
+
+  //! @}
+
+  //! @name Public Conversion Function
+  //! @{
+
+  //! @brief Converts to tree non-constant container iterators.
+  //!
+  //! @details Allows conversion accross tree non-constant container
+  //! iterators.
+  //!
+  //! @tparam OtherIterator The tree non-constant container iterator
+  //! type-constraint template parameter to convert this iterator to.
+  //!
+  //! @return The converted tree non-constant container iterator.
+  template <TreeIterator OtherIterator>
+  operator OtherIterator() const &requires TreeNonConstIterator<Iterator>
+  {
+    return OtherIterator{ node };
+  }
+
+  //! @brief Converts to tree constant container iterators.
+  //!
+  //! @details Allows conversion to constant container iterators.
+  //!
+  //! @tparam OtherIterator The tree constant container iterator
+  //! type-constraint template parameter to convert this iterator to.
+  //!
+  //! @return The converted tree constant container iterator.
+  template <TreeConstIterator OtherIterator>
+  operator OtherIterator() const &requires TreeConstIterator<Iterator>
+  {
+    return OtherIterator{ node };
+  }
+
+  //! @}
+
+  //! @name Public Comparison Function
+  //! @{
+
+  //! @brief Compares the iterators.
+  //!
+  //! @details Checks if the iterators point to the same element.
+  //!
+  //! @param other The iterator to evaluate.
+  //!
+  //! @return `true` if the iterators point to the same element, `false`
+  //! otherwise.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] constexpr bool
+  operator==(const level_iterator_type<Iterator> &other) const noexcept
+  {
+    return node == other.node;
+  }
+
+  //! @}
+
+  //! @name Internal Implementation Member Types
+  //! @{
+
+  //! @brief The internal node data structure type containing the element data.
+  using internal_node_type = std::remove_pointer_t<decltype(Iterator::node)>;
+
+  //! @}
+
+  //! @name Internal Implementation Member Functions
+  //! @{
+
+  //! @brief Finds the next node at a level below a node.
+  //!
+  //! @details The nodes following the given node at its own level are hopped
+  //! across, from the right sibling or from the right cousins, until a node
+  //! with descendants at the requested level is found.
+  //!
+  //! @param node The node to start from, excluded.
+  //! @param levels The number of levels below the node.
+  //!
+  //! @return The first node following the given node in level-order at the
+  //! requested level below it; or `nullptr` if such a node doesn't exist.
+  [[nodiscard]] static constexpr internal_node_type *
+  descend(internal_node_type *node, difference_type levels) noexcept
+  {
+    do {
+      // Climb to the nearest ancestor with a right sibling...
+      while (node && !node->right_sibling) {
+        node = node->parent;
+        ++levels;
+      }
+      if (!node) {
+        return nullptr;
+      }
+      node = node->right_sibling;
+      // ...and descend back along the first children, as far as possible.
+      while (levels && node->first_child) {
+        node = node->first_child;
+        --levels;
+      }
+    } while (levels);
+
+    return node;
+  }
+
+  //! @brief Finds the first node at a level of the container.
+  //!
+  //! @param root The root node of the container, or `nullptr`.
+  //! @param levels The number of levels below the root.
+  //!
+  //! @return The left-most node at the requested level below the root; or
+  //! `nullptr` if such a node doesn't exist.
+  [[nodiscard]] static constexpr internal_node_type *
+  first(internal_node_type *root, difference_type levels) noexcept
+  {
+    if (!root || levels < 0) {
+      return nullptr;
+    }
+
+    internal_node_type *node = root;
+    while (levels && node->first_child) {
+      node = node->first_child;
+      --levels;
+    }
+    if (!levels) {
+      return node;
+    }
+
+    return descend(node, levels);
+  }
+
+  //! @}
+
+  //! @name Internal Implementation Member Variables
+  //! @{
+
+  //! @brief The internal pointer to the node represented by the iterator.
+  internal_node_type *node = nullptr;
+
+  //! @}
+};
+
+//! @brief A sibling tree traversal iterator.
+//!
+//! @details Type to identify and traverse the siblings of a family, from left
+//! to right, through their right sibling links.
+//!
+//! @tparam Iterator The underlying tree member iterator type-constraint
+//! template parameter providing constness and conversion support.
+template <TreeMemberIterator Iterator> struct sibling_iterator_type {
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The type of the contained data elements.
+  using value_type = typename Iterator::value_type;
+
+  //! @brief Signed integer type to represent element distances.
+  using difference_type = typename Iterator::difference_type;
+
+  //! @brief The reference type of the contained data elements.
+  using reference = typename Iterator::reference;
+
+  //! @brief The pointer type of the contained data elements.
+  using pointer = typename Iterator::pointer;
+
+  //! @brief The LegacyForwardIterator requirements category of the iterator.
+  using iterator_category = std::forward_iterator_tag;
+
+  //! @brief The container type of the underlying iterator.
+  using container_type = typename Iterator::container_type;
+
+  //! @}
+
+  //! @name Public Observer Member Functions
+  //! @{
+
+  //! @brief Accesses the stored element data.
+  //!
+  //! @details Indirection operator. Dereferences the iterator to obtain the
+  //! container's stored value. The behavior is undefined if the iterator is
+  //! invalid.
+  //!
+  //! @return Reference to the element if the iterator is dereferencable.
+  [[nodiscard]] constexpr reference operator*() const noexcept
+  {
+    return node->data;
+  }
+
+  //! @brief Points to the stored element.
+  //!
+  //! @details Member access operator. Dereferenceable pointer or pointer-like
+  //! object of the container's stored value from this iterator. The behavior
+  //! is undefined if the iterator is invalid.
+  //!
+  //! @return Pointer to the container's stored value iterator.
+  [[nodiscard]] constexpr pointer operator->() const noexcept
+  {
+    return std::pointer_traits<pointer>::pointer_to(node->data);
+  }
+
+  //! @}
+
+  //! @name Public Modifier Member Functions
+  //! @{
+
+  //! @brief Prefix increments the iterator.
+  //!
+  //! @details The next node is the right sibling.
+  //!
+  //! @return Reference to the next iterator.
+  //!
+  //! @complexity Constant.
+  constexpr sibling_iterator_type &operator++() noexcept
+  {
+    node = node->right_sibling;
+
+    return *this;
+  }
+
+  //! @brief Postfix increments the iterator.
+  //!
+  //! @return Next iterator.
+  //!
+  //! @complexity Constant.
+  constexpr sibling_iterator_type operator++(int) noexcept
+  {
+    sibling_iterator_type temporary_iterator = *this;
+    ++*this;
+
+    return temporary_iterator;
+  }
+
+  //! @}
+
+  //! @name Public Conversion Function
+  //! @{
+
+  //! @brief Converts to tree non-constant container iterators.
+  //!
+  //! @details Allows conversion accross tree non-constant container
+  //! iterators.
+  //!
+  //! @tparam OtherIterator The tree non-constant container iterator
+  //! type-constraint template parameter to convert this iterator to.
+  //!
+  //! @return The converted tree non-constant container iterator.
+  template <TreeIterator OtherIterator>
+  operator OtherIterator() const &requires TreeNonConstIterator<Iterator>
+  {
+    return OtherIterator{ node };
+  }
+
+  //! @brief Converts to tree constant container iterators.
+  //!
+  //! @details Allows conversion to constant container iterators.
+  //!
+  //! @tparam OtherIterator The tree constant container iterator
+  //! type-constraint template parameter to convert this iterator to.
+  //!
+  //! @return The converted tree constant container iterator.
+  template <TreeConstIterator OtherIterator>
+  operator OtherIterator() const &requires TreeConstIterator<Iterator>
+  {
+    return OtherIterator{ node };
+  }
+
+  //! @}
+
+  //! @name Public Comparison Function
+  //! @{
+
+  //! @brief Compares the iterators.
+  //!
+  //! @details Checks if the iterators point to the same element.
+  //!
+  //! @param other The iterator to evaluate.
+  //!
+  //! @return `true` if the iterators point to the same element, `false`
+  //! otherwise.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] constexpr bool
+  operator==(const sibling_iterator_type<Iterator> &other) const noexcept
+  {
+    return node == other.node;
+  }
+
+  //! @}
+
+  //! @name Internal Implementation Member Types
+  //! @{
+
+  //! @brief The internal node data structure type containing the element data.
+  using internal_node_type = std::remove_pointer_t<decltype(Iterator::node)>;
+
+  //! @}
+
+  //! @name Internal Implementation Member Variables
+  //! @{
+
+  //! @brief The internal pointer to the node represented by the iterator.
+  internal_node_type *node = nullptr;
+
+  //! @}
+};
+
+//! @brief An ancestor tree traversal iterator.
+//!
+//! @details Type to identify and traverse the ancestors of an element, from
+//! the nearest to the root, through their parent links.
+//!
+//! @tparam Iterator The underlying tree member iterator type-constraint
+//! template parameter providing constness and conversion support.
+template <TreeMemberIterator Iterator> struct ancestor_iterator_type {
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The type of the contained data elements.
+  using value_type = typename Iterator::value_type;
+
+  //! @brief Signed integer type to represent element distances.
+  using difference_type = typename Iterator::difference_type;
+
+  //! @brief The reference type of the contained data elements.
+  using reference = typename Iterator::reference;
+
+  //! @brief The pointer type of the contained data elements.
+  using pointer = typename Iterator::pointer;
+
+  //! @brief The LegacyForwardIterator requirements category of the iterator.
+  using iterator_category = std::forward_iterator_tag;
+
+  //! @brief The container type of the underlying iterator.
+  using container_type = typename Iterator::container_type;
+
+  //! @}
+
+  //! @name Public Observer Member Functions
+  //! @{
+
+  //! @brief Accesses the stored element data.
+  //!
+  //! @details Indirection operator. Dereferences the iterator to obtain the
+  //! container's stored value. The behavior is undefined if the iterator is
+  //! invalid.
+  //!
+  //! @return Reference to the element if the iterator is dereferencable.
+  [[nodiscard]] constexpr reference operator*() const noexcept
+  {
+    return node->data;
+  }
+
+  //! @brief Points to the stored element.
+  //!
+  //! @details Member access operator. Dereferenceable pointer or pointer-like
+  //! object of the container's stored value from this iterator. The behavior
+  //! is undefined if the iterator is invalid.
+  //!
+  //! @return Pointer to the container's stored value iterator.
+  [[nodiscard]] constexpr pointer operator->() const noexcept
+  {
+    return std::pointer_traits<pointer>::pointer_to(node->data);
+  }
+
+  //! @}
+
+  //! @name Public Modifier Member Functions
+  //! @{
+
+  //! @brief Prefix increments the iterator.
+  //!
+  //! @details The next node is the parent.
+  //!
+  //! @return Reference to the next iterator.
+  //!
+  //! @complexity Constant.
+  constexpr ancestor_iterator_type &operator++() noexcept
+  {
+    node = node->parent;
+
+    return *this;
+  }
+
+  //! @brief Postfix increments the iterator.
+  //!
+  //! @return Next iterator.
+  //!
+  //! @complexity Constant.
+  constexpr ancestor_iterator_type operator++(int) noexcept
+  {
+    ancestor_iterator_type temporary_iterator = *this;
+    ++*this;
+
+    return temporary_iterator;
+  }
+
+  //! @}
+
+  //! @name Public Conversion Function
+  //! @{
+
+  //! @brief Converts to tree non-constant container iterators.
+  //!
+  //! @details Allows conversion accross tree non-constant container
+  //! iterators.
+  //!
+  //! @tparam OtherIterator The tree non-constant container iterator
+  //! type-constraint template parameter to convert this iterator to.
+  //!
+  //! @return The converted tree non-constant container iterator.
+  template <TreeIterator OtherIterator>
+  operator OtherIterator() const &requires TreeNonConstIterator<Iterator>
+  {
+    return OtherIterator{ node };
+  }
+
+  //! @brief Converts to tree constant container iterators.
+  //!
+  //! @details Allows conversion to constant container iterators.
+  //!
+  //! @tparam OtherIterator The tree constant container iterator
+  //! type-constraint template parameter to convert this iterator to.
+  //!
+  //! @return The converted tree constant container iterator.
+  template <TreeConstIterator OtherIterator>
+  operator OtherIterator() const &requires TreeConstIterator<Iterator>
+  {
+    return OtherIterator{ node };
+  }
+
+  //! @}
+
+  //! @name Public Comparison Function
+  //! @{
+
+  //! @brief Compares the iterators.
+  //!
+  //! @details Checks if the iterators point to the same element.
+  //!
+  //! @param other The iterator to evaluate.
+  //!
+  //! @return `true` if the iterators point to the same element, `false`
+  //! otherwise.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] constexpr bool
+  operator==(const ancestor_iterator_type<Iterator> &other) const noexcept
+  {
+    return node == other.node;
+  }
+
+  //! @}
+
+  //! @name Internal Implementation Member Types
+  //! @{
+
+  //! @brief The internal node data structure type containing the element data.
+  using internal_node_type = std::remove_pointer_t<decltype(Iterator::node)>;
+
+  //! @}
+
+  //! @name Internal Implementation Member Variables
+  //! @{
+
+  //! @brief The internal pointer to the node represented by the iterator.
+  internal_node_type *node = nullptr;
+
+  //! @}
+};
+
+//! @brief A leaf tree traversal iterator.
+//!
+//! @details Type to identify and traverse the leaves of a subtree, from left to
+//! right. The leaves are visited in the same order as a depth-first traversal
+//! without visiting the internal nodes.
+//!
+//! @tparam Iterator The underlying tree member iterator type-constraint
+//! template parameter providing constness and conversion support.
+template <TreeMemberIterator Iterator> struct leaf_iterator_type {
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The type of the contained data elements.
+  using value_type = typename Iterator::value_type;
+
+  //! @brief Signed integer type to represent element distances.
+  using difference_type = typename Iterator::difference_type;
+
+  //! @brief The reference type of the contained data elements.
+  using reference = typename Iterator::reference;
+
+  //! @brief The pointer type of the contained data elements.
+  using pointer = typename Iterator::pointer;
+
+  //! @brief The LegacyForwardIterator requirements category of the iterator.
+  using iterator_category = std::forward_iterator_tag;
+
+  //! @brief The container type of the underlying iterator.
+  using container_type = typename Iterator::container_type;
+
+  //! @}
+
+  //! @name Public Observer Member Functions
+  //! @{
+
+  //! @brief Accesses the stored element data.
+  //!
+  //! @details Indirection operator. Dereferences the iterator to obtain the
+  //! container's stored value. The behavior is undefined if the iterator is
+  //! invalid.
+  //!
+  //! @return Reference to the element if the iterator is dereferencable.
+  [[nodiscard]] constexpr reference operator*() const noexcept
+  {
+    return node->data;
+  }
+
+  //! @brief Points to the stored element.
+  //!
+  //! @details Member access operator. Dereferenceable pointer or pointer-like
+  //! object of the container's stored value from this iterator. The behavior
+  //! is undefined if the iterator is invalid.
+  //!
+  //! @return Pointer to the container's stored value iterator.
+  [[nodiscard]] constexpr pointer operator->() const noexcept
+  {
+    return std::pointer_traits<pointer>::pointer_to(node->data);
+  }
+
+  //! @}
+
+  //! @name Public Modifier Member Functions
+  //! @{
+
+  //! @brief Prefix increments the iterator.
+  //!
+  //! @details The next leaf is the left-most leaf of the nearest right sibling
+  //! of the node or of its ancestors, within the bounds of the traversal. The
+  //! internal nodes are only walked through their first child and right
+  //! sibling links, not visited.
+  //!
+  //! @return Reference to the next iterator.
+  //!
+  //! @complexity Amortized constant.
+  constexpr leaf_iterator_type &operator++() noexcept
+  {
+    node = node->next_ancestor_sibling();
+    if (node == boundary) {
+      node = nullptr;
+    } else {
+      while (node->first_child) {
+        node = node->first_child;
+      }
+    }
+
+    return *this;
+  }
+
+  //! @brief Postfix increments the iterator.
+  //!
+  //! @return Next iterator.
+  //!
+  //! @complexity Amortized constant.
+  constexpr leaf_iterator_type operator++(int) noexcept
+  {
+    leaf_iterator_type temporary_iterator = *this;
+    ++*this;
+
+    return temporary_iterator;
+  }
+
+  //! @}
+
+  //! @name Public Conversion Function
+  //! @{
+
+  //! @brief Converts to tree non-constant container iterators.
+  //!
+  //! @details Allows conversion accross tree non-constant container
+  //! iterators.
+  //!
+  //! @tparam OtherIterator The tree non-constant container iterator
+  //! type-constraint template parameter to convert this iterator to.
+  //!
+  //! @return The converted tree non-constant container iterator.
+  template <TreeIterator OtherIterator>
+  operator OtherIterator() const &requires TreeNonConstIterator<Iterator>
+  {
+    return OtherIterator{ node };
+  }
+
+  //! @brief Converts to tree constant container iterators.
+  //!
+  //! @details Allows conversion to constant container iterators.
+  //!
+  //! @tparam OtherIterator The tree constant container iterator
+  //! type-constraint template parameter to convert this iterator to.
+  //!
+  //! @return The converted tree constant container iterator.
+  template <TreeConstIterator OtherIterator>
+  operator OtherIterator() const &requires TreeConstIterator<Iterator>
+  {
+    return OtherIterator{ node };
+  }
+
+  //! @}
+
+  //! @name Public Comparison Function
+  //! @{
+
+  //! @brief Compares the iterators.
+  //!
+  //! @details Checks if the iterators point to the same element.
+  //!
+  //! @param other The iterator to evaluate.
+  //!
+  //! @return `true` if the iterators point to the same element, `false`
+  //! otherwise.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] constexpr bool
+  operator==(const leaf_iterator_type<Iterator> &other) const noexcept
+  {
+    return node == other.node;
+  }
+
+  //! @}
+
+  //! @name Internal Implementation Member Types
+  //! @{
+
+  //! @brief The internal node data structure type containing the element data.
+  using internal_node_type = std::remove_pointer_t<decltype(Iterator::node)>;
+
+  //! @}
+
+  //! @name Internal Implementation Member Variables
+  //! @{
+
+  //! @brief The internal pointer to the node represented by the iterator.
+  internal_node_type *node = nullptr;
+
+  //! @brief The internal pointer to the node following the last leaf of the
+  //! traversal, or `nullptr` if the traversal ends with the container.
+  internal_node_type *boundary = nullptr;
+
+  //! @}
+};
+
+//! @name Deduction Guides
+//! @{
+
+depth_first_pre_order_iterator_type(TreeMemberIterator auto position)
+    -> depth_first_pre_order_iterator_type<decltype(position)>;
+
+depth_first_pre_order_prefetch_iterator_type(
+    TreeMemberIterator auto position)
+    -> depth_first_pre_order_prefetch_iterator_type<decltype(position)>;
+
+depth_aware_iterator_type(TreeMemberIterator auto position)
+    -> depth_aware_iterator_type<decltype(position)>;
+
+depth_first_post_order_iterator_type(TreeMemberIterator auto position)
+    -> depth_first_post_order_iterator_type<decltype(position)>;
+
+level_iterator_type(TreeMemberIterator auto position)
+    -> level_iterator_type<decltype(position)>;
+
+sibling_iterator_type(TreeMemberIterator auto position)
+    -> sibling_iterator_type<decltype(position)>;
+
+ancestor_iterator_type(TreeMemberIterator auto position)
+    -> ancestor_iterator_type<decltype(position)>;
+
+leaf_iterator_type(TreeMemberIterator auto position)
+    -> leaf_iterator_type<decltype(position)>;
+
+//! @}
+
+//! @name Non-Member Iterator Functions
+//! @{
+
+//! @brief Returns a post-order iterator to the first element of the container.
+//!
+//! @details The first element in post-order is the left-most leaf of the
+//! container.
+//!
+//! @param container The container to traverse.
+//!
+//! @return The post-order iterator to the first element, or the ending
+//! iterator if the container is empty.
+//!
+//! @complexity Linear in the height of the container.
+template <typename Type, typename Allocator, typename NodePolicy>
+[[nodiscard]] constexpr auto
+post_order_begin(tree<Type, Allocator, NodePolicy> &container)
+{
+  using iterator_type = depth_first_post_order_iterator_type<
+      typename tree<Type, Allocator, NodePolicy>::iterator>;
+
+  return iterator_type{ iterator_type::first_leaf(container.begin().node) };
+}
+
+//! @brief Returns a post-order iterator to the first element of the container.
+//!
+//! @details The first element in post-order is the left-most leaf of the
+//! container.
+//!
+//! @param container The container to traverse.
+//!
+//! @return The constant post-order iterator to the first element, or the
+//! ending iterator if the container is empty.
+//!
+//! @complexity Linear in the height of the container.
+template <typename Type, typename Allocator, typename NodePolicy>
+[[nodiscard]] constexpr auto
+post_order_begin(const tree<Type, Allocator, NodePolicy> &container)
+{
+  using iterator_type = depth_first_post_order_iterator_type<
+      typename tree<Type, Allocator, NodePolicy>::const_iterator>;
+
+  return iterator_type{ iterator_type::first_leaf(container.begin().node) };
+}
+
+//! @brief Returns a post-order iterator to the element following the last
+//! element of the container.
+//!
+//! @param container The container to traverse.
+//!
+//! @return The post-order ending iterator.
+//!
+//! @complexity Constant.
+template <typename Type, typename Allocator, typename NodePolicy>
+[[nodiscard]] constexpr auto
+post_order_end(
+    [[maybe_unused]] tree<Type, Allocator, NodePolicy> &container) noexcept
+{
+  return depth_first_post_order_iterator_type<
+      typename tree<Type, Allocator, NodePolicy>::iterator>{};
+}
+
+//! @brief Returns a post-order iterator to the element following the last
+//! element of the container.
+//!
+//! @param container The container to traverse.
+//!
+//! @return The constant post-order ending iterator.
+//!
+//! @complexity Constant.
+template <typename Type, typename Allocator, typename NodePolicy>
+[[nodiscard]] constexpr auto
+post_order_end([[maybe_unused]] const tree<Type, Allocator, NodePolicy>
+                   &container) noexcept
+{
+  return depth_first_post_order_iterator_type<
+      typename tree<Type, Allocator, NodePolicy>::const_iterator>{};
+}
+
+//! @brief Returns a breadth-first iterator to the first element of the
+//! container.
+//!
+//! @details The frontier of the iterator is allocated from a copy of the
+//! container's allocator.
+//!
+//! @param container The container to traverse.
+//!
+//! @return The breadth-first iterator to the root element, or the ending
+//! iterator if the container is empty.
+//!
+//! @complexity Constant.
+template <typename Type, typename Allocator, typename NodePolicy>
+[[nodiscard]] constexpr auto
+breadth_first_begin(tree<Type, Allocator, NodePolicy> &container)
+{
+  return breadth_first_iterator_type<
+      typename tree<Type, Allocator, NodePolicy>::iterator, Allocator>{
+    container.begin().node, container.get_allocator()
+  };
+}
+
+//! @brief Returns a breadth-first iterator to the first element of the
+//! container.
+//!
+//! @details The frontier of the iterator is allocated from a copy of the
+//! container's allocator.
+//!
+//! @param container The container to traverse.
+//!
+//! @return The constant breadth-first iterator to the root element, or the
+//! ending iterator if the container is empty.
+//!
+//! @complexity Constant.
+template <typename Type, typename Allocator, typename NodePolicy>
+[[nodiscard]] constexpr auto
+breadth_first_begin(const tree<Type, Allocator, NodePolicy> &container)
+{
+  return breadth_first_iterator_type<
+      typename tree<Type, Allocator, NodePolicy>::const_iterator, Allocator>{
+    container.begin().node, container.get_allocator()
+  };
+}
+
+//! @brief Returns a breadth-first iterator to the element following the last
+//! element of the container.
+//!
+//! @param container The container to traverse.
+//!
+//! @return The breadth-first ending iterator.
+//!
+//! @complexity Constant.
+template <typename Type, typename Allocator, typename NodePolicy>
+[[nodiscard]] constexpr auto
+breadth_first_end(tree<Type, Allocator, NodePolicy> &container)
+{
+  return breadth_first_iterator_type<
+      typename tree<Type, Allocator, NodePolicy>::iterator, Allocator>{
+    nullptr, container.get_allocator()
+  };
+}
+
+//! @brief Returns a breadth-first iterator to the element following the last
+//! element of the container.
+//!
+//! @param container The container to traverse.
+//!
+//! @return The constant breadth-first ending iterator.
+//!
+//! @complexity Constant.
+template <typename Type, typename Allocator, typename NodePolicy>
+[[nodiscard]] constexpr auto
+breadth_first_end(const tree<Type, Allocator, NodePolicy> &container)
+{
+  return breadth_first_iterator_type<
+      typename tree<Type, Allocator, NodePolicy>::const_iterator, Allocator>{
+    nullptr, container.get_allocator()
+  };
+}
 
 //! @}
 } // namespace fcarouge
@@ -39,6 +39,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #ifndef FCAROUGE_TREE_ITERATOR_FWD_HPP
 #define FCAROUGE_TREE_ITERATOR_FWD_HPP
 
+#include <memory>
+// std::allocator
+
 #include <type_traits>
 // std::is_same_v
 
@@ -55,6 +58,25 @@ namespace fcarouge
 template <TreeMemberIterator Iterator>
 struct depth_first_pre_order_iterator_type;
 
+template <TreeMemberIterator Iterator>
+struct depth_first_pre_order_prefetch_iterator_type;
+
+template <TreeMemberIterator Iterator> struct depth_aware_iterator_type;
+
+template <TreeMemberIterator Iterator>
+struct depth_first_post_order_iterator_type;
+
+template <TreeMemberIterator Iterator, typename Allocator>
+class breadth_first_iterator_type;
+
+template <TreeMemberIterator Iterator> struct level_iterator_type;
+
+template <TreeMemberIterator Iterator> struct sibling_iterator_type;
+
+template <TreeMemberIterator Iterator> struct ancestor_iterator_type;
+
+template <TreeMemberIterator Iterator> struct leaf_iterator_type;
+
 //! @}
 
 //! @name Type Aliases
@@ -64,6 +86,36 @@ template <typename Type>
 using depth_first_pre_order_iterator =
     depth_first_pre_order_iterator_type<typename tree<Type>::iterator>;
 
+template <typename Type>
+using depth_first_pre_order_prefetch_iterator =
+    depth_first_pre_order_prefetch_iterator_type<
+        typename tree<Type>::iterator>;
+
+template <typename Type>
+using depth_aware_iterator =
+    depth_aware_iterator_type<typename tree<Type>::iterator>;
+
+template <typename Type>
+using depth_first_post_order_iterator =
+    depth_first_post_order_iterator_type<typename tree<Type>::iterator>;
+
+template <typename Type>
+using breadth_first_iterator =
+    breadth_first_iterator_type<typename tree<Type>::iterator,
+                                std::allocator<Type>>;
+
+template <typename Type>
+using level_iterator = level_iterator_type<typename tree<Type>::iterator>;
+
+template <typename Type>
+using sibling_iterator = sibling_iterator_type<typename tree<Type>::iterator>;
+
+template <typename Type>
+using ancestor_iterator = ancestor_iterator_type<typename tree<Type>::iterator>;
+
+template <typename Type>
+using leaf_iterator = leaf_iterator_type<typename tree<Type>::iterator>;
+
 //! @}
 
 //! @name Concepts
@@ -91,6 +143,46 @@ concept TreeNonConstIterator =
         std::remove_cvref_t<depth_first_pre_order_iterator<
             std::remove_cvref_t<typename tree<typename std::iterator_traits<
                 NonConstIterator>::value_type>::iterator::value_type>>>> ||
+    std::is_same_v<
+        NonConstIterator,
+        std::remove_cvref_t<depth_first_pre_order_prefetch_iterator<
+            std::remove_cvref_t<typename tree<typename std::iterator_traits<
+                NonConstIterator>::value_type>::iterator::value_type>>>> ||
+    std::is_same_v<
+        NonConstIterator,
+        std::remove_cvref_t<depth_aware_iterator<
+            std::remove_cvref_t<typename tree<typename std::iterator_traits<
+                NonConstIterator>::value_type>::iterator::value_type>>>> ||
+    std::is_same_v<
+        NonConstIterator,
+        std::remove_cvref_t<depth_first_post_order_iterator<
+            std::remove_cvref_t<typename tree<typename std::iterator_traits<
+                NonConstIterator>::value_type>::iterator::value_type>>>> ||
+    std::is_same_v<
+        NonConstIterator,
+        std::remove_cvref_t<breadth_first_iterator<
+            std::remove_cvref_t<typename tree<typename std::iterator_traits<
+                NonConstIterator>::value_type>::iterator::value_type>>>> ||
+    std::is_same_v<
+        NonConstIterator,
+        std::remove_cvref_t<level_iterator<
+            std::remove_cvref_t<typename tree<typename std::iterator_traits<
+                NonConstIterator>::value_type>::iterator::value_type>>>> ||
+    std::is_same_v<
+        NonConstIterator,
+        std::remove_cvref_t<sibling_iterator<
+            std::remove_cvref_t<typename tree<typename std::iterator_traits<
+                NonConstIterator>::value_type>::iterator::value_type>>>> ||
+    std::is_same_v<
+        NonConstIterator,
+        std::remove_cvref_t<ancestor_iterator<
+            std::remove_cvref_t<typename tree<typename std::iterator_traits<
+                NonConstIterator>::value_type>::iterator::value_type>>>> ||
+    std::is_same_v<
+        NonConstIterator,
+        std::remove_cvref_t<leaf_iterator<
+            std::remove_cvref_t<typename tree<typename std::iterator_traits<
+                NonConstIterator>::value_type>::iterator::value_type>>>> ||
     TreeMemberNonConstIterator<NonConstIterator>;
 
 //! @brief Tree iterators concept.
@@ -0,0 +1,299 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+//! @file
+//! @brief Tree views header.
+//!
+//! @details The header contains the non-member range views defined and
+//! applicable to the tree container.
+
+#ifndef FCAROUGE_TREE_VIEW_HPP
+#define FCAROUGE_TREE_VIEW_HPP
+
+#include <ranges>
+// std::ranges::subrange std::ranges::view_interface
+
+#include <type_traits>
+// std::conditional_t std::remove_cvref_t
+
+#include "tree_iterator.hpp"
+
+#include "tree_view_fwd.hpp"
+
+#include "tree_iterator_fwd.hpp"
+
+#include "tree_fwd.hpp"
+
+//! @namespace fcarouge Francois Carouge's projects namespace. Lowers the name
+//! conflict probability in large projects. Use using-declarations or
+//! namespace-alias-definition per your project guidelines.
+namespace fcarouge
+{
+//! @brief A view of the elements of one level of the container.
+//!
+//! @details The elements at a given depth are viewed from left to right. The
+//! view hops across siblings and cousins without visiting the other elements
+//! of the level, nor revisiting the ancestors of a family.
+//!
+//! @tparam Iterator The underlying tree member iterator type-constraint
+//! template parameter providing constness and conversion support.
+template <TreeMemberIterator Iterator>
+class level_view : public std::ranges::view_interface<level_view<Iterator>>
+{
+  public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The type of the iterators of the view.
+  using iterator = level_iterator_type<Iterator>;
+
+  //! @brief Signed integer type to represent element distances.
+  using difference_type = typename Iterator::difference_type;
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief Constructs an empty view.
+  //!
+  //! @complexity Constant.
+  constexpr level_view() noexcept = default;
+
+  //! @brief Constructs the view of a level of a container.
+  //!
+  //! @details The container must outlive the view. The view is empty if the
+  //! container has no element at the given depth.
+  //!
+  //! @tparam Container The type template parameter of the viewed container.
+  //!
+  //! @param container The container to view.
+  //! @param depth The depth of the level, the root being at depth `0`.
+  //!
+  //! @complexity Linear in the size of the shallower levels at worst.
+  template <typename Container>
+  constexpr level_view(Container &container, difference_type depth) noexcept
+          : first{ iterator::first(container.begin().node, depth) }
+  {
+  }
+
+  //! @}
+
+  //! @name Public Iterators Member Functions
+  //! @{
+
+  //! @brief Returns an iterator to the first element of the level.
+  //!
+  //! @return The iterator to the left-most element of the level.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] constexpr iterator begin() const noexcept
+  {
+    return { first };
+  }
+
+  //! @brief Returns an iterator to the element following the last element of
+  //! the level.
+  //!
+  //! @return The ending iterator.
+  //!
+  //! @complexity Constant.
+  [[nodiscard]] constexpr iterator end() const noexcept
+  {
+    return {};
+  }
+
+  //! @}
+
+  private:
+  //! @name Private Member Types
+  //! @{
+
+  //! @brief The internal node data structure type containing the element data.
+  using internal_node_type = typename iterator::internal_node_type;
+
+  //! @}
+
+  //! @name Private Member Variables
+  //! @{
+
+  //! @brief The left-most node of the level.
+  internal_node_type *first = nullptr;
+
+  //! @}
+};
+
+//! @name Non-Member View Functions
+//! @{
+
+//! @brief The tree member iterator type of the constness of a tree iterator.
+//!
+//! @tparam Iterator The tree iterator type-constraint template parameter.
+template <TreeIterator Iterator>
+using internal_member_iterator_type = std::conditional_t<
+    TreeConstIterator<Iterator>,
+    typename std::remove_cvref_t<Iterator>::container_type::const_iterator,
+    typename std::remove_cvref_t<Iterator>::container_type::iterator>;
+
+//! @brief Returns a view of the children of an element.
+//!
+//! @details The children are viewed from the first to the last child. The
+//! behavior is undefined if the iterator is not dereferenceable.
+//!
+//! @param position The iterator to the parent element.
+//!
+//! @return The forward view of the children of the element.
+//!
+//! @complexity Constant, and constant per step.
+[[nodiscard]] constexpr auto children(TreeIterator auto position) noexcept
+{
+  using iterator = sibling_iterator_type<
+      internal_member_iterator_type<decltype(position)>>;
+
+  return std::ranges::subrange{ iterator{ position.node->first_child },
+                                iterator{} };
+}
+
+//! @brief Returns a view of the ancestors of an element.
+//!
+//! @details The ancestors are viewed from the parent to the root, the element
+//! is excluded. The behavior is undefined if the iterator is not
+//! dereferenceable.
+//!
+//! @param position The iterator to the descendant element.
+//!
+//! @return The forward view of the ancestors of the element.
+//!
+//! @complexity Constant, and constant per step.
+[[nodiscard]] constexpr auto ancestors(TreeIterator auto position) noexcept
+{
+  using iterator = ancestor_iterator_type<
+      internal_member_iterator_type<decltype(position)>>;
+
+  return std::ranges::subrange{ iterator{ position.node->parent },
+                                iterator{} };
+}
+
+//! @brief Returns a view of the siblings of an element.
+//!
+//! @details The siblings are the children of the parent of the element,
+//! including the element, viewed from the first to the last child. The root
+//! is its sole sibling. The behavior is undefined if the iterator is not
+//! dereferenceable.
+//!
+//! @param position The iterator to the element.
+//!
+//! @return The forward view of the siblings of the element.
+//!
+//! @complexity Constant, and constant per step.
+[[nodiscard]] constexpr auto siblings(TreeIterator auto position) noexcept
+{
+  using iterator = sibling_iterator_type<
+      internal_member_iterator_type<decltype(position)>>;
+
+  return std::ranges::subrange{
+    iterator{ position.node->parent ? position.node->parent->first_child
+                                    : position.node },
+    iterator{}
+  };
+}
+
+//! @brief Returns a view of the leaves of the subtree of an element.
+//!
+//! @details The leaves are viewed from left to right, without visiting the
+//! internal elements. A leaf element is its own sole leaf. The behavior is
+//! undefined if the iterator is not dereferenceable.
+//!
+//! @param position The iterator to the root element of the subtree.
+//!
+//! @return The forward view of the leaves of the subtree.
+//!
+//! @complexity Linear in the height of the subtree, and amortized constant per
+//! step.
+[[nodiscard]] constexpr auto leaves(TreeIterator auto position) noexcept
+{
+  using iterator =
+      leaf_iterator_type<internal_member_iterator_type<decltype(position)>>;
+
+  auto *leaf = position.node;
+  while (leaf->first_child) {
+    leaf = leaf->first_child;
+  }
+
+  return std::ranges::subrange{
+    iterator{ leaf, position.node->next_ancestor_sibling() }, iterator{}
+  };
+}
+
+//! @brief Returns a pre-order range of the subtree of an element.
+//!
+//! @details The subtree is traversed in pre-order from the element. The end of
+//! the range is the element following the subtree in pre-order, the nearest
+//! right sibling of the element or of its ancestors, such that the traversal
+//! stays within the subtree with the cost of the pre-order iterator. The end
+//! of the range knows the element as its root, so that decrementing it
+//! reaches the last descendant of the element, including when the subtree
+//! ends with the container. The iterators of the range support pruning the
+//! descendants of an element with `skip_subtree()`. The behavior is undefined
+//! if the iterator is not dereferenceable.
+//!
+//! @param position The iterator to the root element of the subtree.
+//!
+//! @return The pre-order range of the subtree of the element.
+//!
+//! @complexity Linear in the depth of the element.
+[[nodiscard]] constexpr auto subtree(TreeIterator auto position) noexcept
+{
+  using iterator = depth_first_pre_order_iterator_type<
+      internal_member_iterator_type<decltype(position)>>;
+
+  return std::ranges::subrange{
+    iterator{ position.node },
+    iterator{ position.node->next_ancestor_sibling(), position.node }
+  };
+}
+
+//! @}
+
+//! @name Deduction Guides
+//! @{
+
+template <typename Type, typename Allocator, typename NodePolicy,
+          typename Depth>
+level_view(tree<Type, Allocator, NodePolicy> &container, Depth depth)
+    -> level_view<typename tree<Type, Allocator, NodePolicy>::iterator>;
+
+template <typename Type, typename Allocator, typename NodePolicy,
+          typename Depth>
+level_view(const tree<Type, Allocator, NodePolicy> &container, Depth depth)
+    -> level_view<typename tree<Type, Allocator, NodePolicy>::const_iterator>;
+
+//! @}
+} // namespace fcarouge
+
+#endif // FCAROUGE_TREE_VIEW_HPP
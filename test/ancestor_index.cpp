@@ -0,0 +1,109 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_algorithm.hpp"
+// fcarouge::depth
+
+#include "fcarouge/tree_index.hpp"
+// fcarouge::ancestor_index
+
+#include <cassert>
+// assert
+
+namespace
+{
+//! @test Verify the ancestors of every node of a chain and a complex container.
+//!
+//! @dot
+//! digraph {
+//!   node [shape=circle fontsize="10"];
+//!   0 -> {1, 2}
+//!   1 -> {11 -> 111 -> 1111 -> 11111}
+//!   2 -> {21, 22}
+//!   22 -> {221}
+//! }
+//! @enddot
+[[maybe_unused]] auto complex = []() {
+  fcarouge::tree_int fecamp_pine(0);
+  auto chain = fecamp_pine.push(fecamp_pine.begin(), 1);
+  for (int value : { 11, 111, 1111, 11111 }) {
+    chain = fecamp_pine.push(chain, value);
+  }
+  const auto node2 = fecamp_pine.push(fecamp_pine.begin(), 2);
+  fecamp_pine.push(node2, 21);
+  fecamp_pine.push(fecamp_pine.push(node2, 22), 221);
+
+  fcarouge::ancestor_index index{ fecamp_pine };
+  for (auto position = fecamp_pine.cbegin(); position != fecamp_pine.cend();
+       ++position) {
+    auto ancestor = position;
+    for (auto distance = 0; distance <= depth(position); ++distance) {
+      assert(ancestor == index.ancestor(position, distance) &&
+             "The k-th ancestor must meet requirements.");
+      assert(ancestor == index.ancestor_at_depth(position, depth(ancestor)) &&
+             "The level ancestor must meet requirements.");
+      ancestor = fcarouge::tree<int>::const_iterator{ ancestor.node->parent };
+    }
+    assert(fecamp_pine.cend() ==
+               index.ancestor(position, depth(position) + 1) &&
+           "The ancestor beyond the root must be the ending iterator.");
+    assert(fecamp_pine.cend() == index.ancestor_at_depth(position, -1) &&
+           "The ancestor at a negative depth must be the ending iterator.");
+  }
+
+  return 0;
+}();
+
+//! @test Verify the index is rebuilt after modifications of the container.
+[[maybe_unused]] auto rebuild = []() {
+  fcarouge::tree_int fecamp_pine(0);
+  const auto node1 = fecamp_pine.push(fecamp_pine.begin(), 1);
+  const auto node11 = fecamp_pine.push(node1, 11);
+
+  fcarouge::ancestor_index index{ fecamp_pine };
+  assert(fecamp_pine.begin() == index.ancestor(node11, 2) &&
+         "The second ancestor must be the root.");
+
+  fecamp_pine.push_front(-1);
+  assert(fecamp_pine.begin() == index.ancestor_at_depth(node11, 0) &&
+         "The index must be rebuilt after a new root.");
+  assert(node1 == index.ancestor_at_depth(node11, 2) &&
+         "The index must be rebuilt after a new root.");
+
+  fecamp_pine.erase(node1);
+  fecamp_pine.push(fecamp_pine.begin(), 2);
+  assert(fecamp_pine.begin() == index.ancestor(++fecamp_pine.begin(), 1) &&
+         "The index must be rebuilt after erasures.");
+
+  return 0;
+}();
+
+} // namespace
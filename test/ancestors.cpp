@@ -0,0 +1,104 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_view.hpp"
+// fcarouge::ancestors
+
+#include <algorithm>
+// std::ranges::equal
+
+#include <cassert>
+// assert
+
+#include <memory_resource>
+// std::pmr::monotonic_buffer_resource std::pmr::polymorphic_allocator
+
+#include <ranges>
+// std::ranges::distance std::ranges::empty std::ranges::forward_range
+// std::ranges::view
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @test Verify the view meet the forward range and view concepts.
+[[maybe_unused]] constexpr auto concepts = []() {
+  using view = decltype(fcarouge::ancestors(fcarouge::tree<int>::iterator{}));
+  static_assert(std::ranges::view<view>,
+                "The container's ancestors view must meet the view concept.");
+  static_assert(std::ranges::forward_range<view>,
+                "The container's ancestors view must meet the forward range "
+                "concept.");
+
+  return 0;
+}();
+
+//! @test Verify the ancestors of the elements.
+[[maybe_unused]] auto lineage = []() {
+  fcarouge::tree_int coutances_birch(0);
+  const auto node1 = coutances_birch.push(coutances_birch.begin(), 1);
+  const auto node11 = coutances_birch.push(node1, 11);
+  const auto node111 = coutances_birch.push(node11, 111);
+  coutances_birch.push(coutances_birch.begin(), 2);
+
+  assert(std::ranges::equal(fcarouge::ancestors(node111),
+                            std::vector{ 11, 1, 0 }) &&
+         "The ancestors must be viewed from the parent to the root.");
+  assert(2 == std::ranges::distance(fcarouge::ancestors(node11)) &&
+         "The element must not be its own ancestor.");
+  assert(std::ranges::empty(fcarouge::ancestors(coutances_birch.cbegin())) &&
+         "The root has no ancestors.");
+
+  return 0;
+}();
+
+//! @test Verify the ancestors of an element of a container with a
+//! non-default allocator.
+[[maybe_unused]] auto allocator = []() {
+  std::pmr::monotonic_buffer_resource resource;
+  fcarouge::tree<int, std::pmr::polymorphic_allocator<int>> coutances_birch{
+    std::pmr::polymorphic_allocator<int>{ &resource }
+  };
+  coutances_birch.emplace(coutances_birch.end(), 0);
+  const auto node1 = coutances_birch.push(coutances_birch.begin(), 1);
+  const auto node11 = coutances_birch.push(node1, 11);
+
+  assert(std::ranges::equal(fcarouge::ancestors(node11),
+                            std::vector{ 1, 0 }) &&
+         "The ancestors must be viewed from the parent to the root.");
+  assert(std::ranges::empty(fcarouge::ancestors(coutances_birch.cbegin())) &&
+         "The root has no ancestors.");
+
+  return 0;
+}();
+
+} // namespace
@@ -0,0 +1,143 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/augmented_tree.hpp"
+// fcarouge::augmented_tree
+
+#include <algorithm>
+// std::max
+
+#include <cassert>
+// assert
+
+#include <memory>
+// std::allocator
+
+#include <string>
+// std::string
+
+namespace
+{
+//! @test Verify the subtree aggregates follow the insertions.
+//!
+//! @dot
+//! digraph {
+//!   node [shape=circle fontsize="10"];
+//!   1 -> {2, 3}
+//!   2 -> {4, 5}
+//! }
+//! @enddot
+[[maybe_unused]] auto insertion = []() {
+  fcarouge::augmented_tree<int> deauville_maple;
+  const auto node1 = deauville_maple.emplace_front(1);
+  const auto node2 = deauville_maple.push(node1, 2);
+  const auto node3 = deauville_maple.push(node1, 3);
+  const auto node5 = deauville_maple.push(node2, 5);
+  const auto node4 = deauville_maple.emplace(node5, 4);
+
+  assert(15 == deauville_maple.aggregate(node1) &&
+         "The root aggregate must meet requirements.");
+  assert(11 == deauville_maple.aggregate(node2) &&
+         "The subtree aggregate must meet requirements.");
+  assert(3 == node3->aggregate && "The leaf aggregate is its weight.");
+  assert(4 == node4->aggregate && "The leaf aggregate is its weight.");
+
+  const auto node0 = deauville_maple.emplace_front(10);
+  assert(25 == deauville_maple.aggregate(node0) &&
+         "The new root aggregate must include the previous root.");
+
+  return 0;
+}();
+
+//! @test Verify the subtree aggregates follow the erasures.
+[[maybe_unused]] auto erasure = []() {
+  fcarouge::augmented_tree<int> deauville_maple;
+  const auto node1 = deauville_maple.emplace_front(1);
+  const auto node2 = deauville_maple.push(node1, 2);
+  deauville_maple.push(deauville_maple.push(node2, 3), 4);
+  deauville_maple.push(node1, 5);
+
+  deauville_maple.erase(node2);
+  assert(6 == deauville_maple.aggregate(node1) &&
+         "The aggregate must exclude the erased subtree.");
+  assert(2 == deauville_maple.size() &&
+         "The erased subtree must be removed.");
+
+  return 0;
+}();
+
+//! @test Verify the subtree aggregates follow the modified values.
+[[maybe_unused]] auto modification = []() {
+  const auto maximum = [](int lhs, int rhs) { return std::max(lhs, rhs); };
+  fcarouge::augmented_tree<int, std::allocator<int>, decltype(maximum)>
+      deauville_maple{ maximum };
+  const auto node1 = deauville_maple.emplace_front(1);
+  const auto node2 = deauville_maple.push(node1, 2);
+  const auto node3 = deauville_maple.push(node2, 3);
+  deauville_maple.push(node1, 7);
+
+  assert(7 == deauville_maple.aggregate(node1) &&
+         "The maximum must meet requirements.");
+  deauville_maple.modify(node3, [](int &value) { value = 42; });
+  assert(42 == node3->value && "The value must be modified.");
+  assert(42 == deauville_maple.aggregate(node2) &&
+         "The aggregate must follow the modified value.");
+  assert(42 == deauville_maple.aggregate(node1) &&
+         "The aggregate must follow the modified value.");
+  deauville_maple.modify(node3, [](int &value) { value = 0; });
+  assert(7 == deauville_maple.aggregate(node1) &&
+         "The aggregate must follow the modified value.");
+
+  return 0;
+}();
+
+//! @test Verify a projected non-commutative aggregate follows the pre-order.
+[[maybe_unused]] auto projection = []() {
+  struct file {
+    std::string name;
+    int bytes;
+  };
+  const auto concatenate = [](const std::string &lhs, const std::string &rhs) {
+    return lhs + rhs;
+  };
+  const auto name = [](const file &value) { return value.name; };
+  fcarouge::augmented_tree<file, std::allocator<file>, decltype(concatenate),
+                           decltype(name)>
+      deauville_maple{ concatenate, name };
+  const auto root = deauville_maple.emplace_front(file{ "a", 0 });
+  const auto node_c = deauville_maple.push(root, file{ "c", 0 });
+  deauville_maple.emplace(node_c, file{ "b", 0 });
+  deauville_maple.push(node_c, file{ "d", 0 });
+
+  assert("abcd" == deauville_maple.aggregate(root) &&
+         "The aggregate must follow the pre-order.");
+
+  return 0;
+}();
+
+} // namespace
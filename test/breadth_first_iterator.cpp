@@ -0,0 +1,162 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_iterator.hpp"
+// fcarouge::breadth_first_begin fcarouge::breadth_first_end
+// fcarouge::breadth_first_iterator
+
+#include <algorithm>
+// std::equal
+
+#include <cassert>
+// assert
+
+#include <iterator>
+// std::forward_iterator
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @test Verify the iterator meet the forward iterator concept.
+[[maybe_unused]] constexpr auto forward_iterator = []() {
+  static_assert(std::forward_iterator<fcarouge::breadth_first_iterator<int>>,
+                "The container's breadth first iterator must meet the forward "
+                "iterator concept.");
+
+  return 0;
+}();
+
+//! @test Verify the order of the breadth first iterator.
+[[maybe_unused]] auto iterate = []() {
+  fcarouge::tree_int vire_chestnut(0);
+  vire_chestnut.push(
+      vire_chestnut.push(vire_chestnut.push(vire_chestnut.begin(), 1), 11),
+      111);
+  vire_chestnut.push(vire_chestnut.begin(), 2);
+  vire_chestnut.push(vire_chestnut.begin(), 3);
+  const auto it = vire_chestnut.push(vire_chestnut.begin(), 5);
+  vire_chestnut.emplace(vire_chestnut.push(vire_chestnut.push(it, 51), 512),
+                        511);
+  vire_chestnut.emplace(vire_chestnut.push(vire_chestnut.push(it, 52), 522),
+                        521);
+
+  // 0
+  // ├── 1
+  // │   └── 11
+  // │       └── 111
+  // ├── 2
+  // ├── 3
+  // └── 5
+  //     ├── 51
+  //     │   ├── 511
+  //     │   └── 512
+  //     └── 52
+  //         ├── 521
+  //         └── 522
+
+  const std::vector<int> expected_content{ 0,   1,   2,   3,   5,   11, 51,
+                                           52,  111, 511, 512, 521, 522 };
+
+  assert(std::equal(fcarouge::breadth_first_begin(vire_chestnut),
+                    fcarouge::breadth_first_end(vire_chestnut),
+                    expected_content.begin(), expected_content.end()) &&
+         "The breadth first traversal must meet requirements.");
+
+  const auto &const_vire_chestnut = vire_chestnut;
+  assert(std::equal(fcarouge::breadth_first_begin(const_vire_chestnut),
+                    fcarouge::breadth_first_end(const_vire_chestnut),
+                    expected_content.begin(), expected_content.end()) &&
+         "The constant breadth first traversal must meet requirements.");
+
+  return 0;
+}();
+
+//! @test Verify a copied iterator resumes the traversal independently.
+[[maybe_unused]] auto copy = []() {
+  fcarouge::tree_int vire_chestnut(0);
+  const auto node1 = vire_chestnut.push(vire_chestnut.begin(), 1);
+  const auto node2 = vire_chestnut.push(vire_chestnut.begin(), 2);
+  vire_chestnut.push(node1, 11);
+  vire_chestnut.push(node2, 21);
+
+  auto position = fcarouge::breadth_first_begin(vire_chestnut);
+  ++position;
+  auto other_position = position;
+  assert(1 == *position++ && "The postfix increment returns the previous.");
+  assert(2 == *position && "The iterator must advance.");
+  assert(1 == *other_position && "The copy must not advance.");
+  ++++other_position;
+  assert(11 == *other_position &&
+         "The copy must resume the traversal with its own frontier.");
+  position = other_position;
+  assert(21 == *++position &&
+         "The assigned iterator must resume the traversal.");
+
+  return 0;
+}();
+
+//! @test Verify the frontier grows with the width of the container.
+[[maybe_unused]] auto wide = []() {
+  fcarouge::tree_int vire_chestnut(0);
+  std::vector<int> expected_content{ 0 };
+  std::vector<fcarouge::tree<int>::iterator> children;
+  for (int i = 1; i <= 100; ++i) {
+    children.push_back(vire_chestnut.push(vire_chestnut.begin(), i));
+    expected_content.push_back(i);
+  }
+  for (const auto &child : children) {
+    vire_chestnut.push(child, *child * 1000);
+    expected_content.push_back(*child * 1000);
+  }
+
+  assert(std::equal(fcarouge::breadth_first_begin(vire_chestnut),
+                    fcarouge::breadth_first_end(vire_chestnut),
+                    expected_content.begin(), expected_content.end()) &&
+         "The breadth first traversal of a wide container must meet "
+         "requirements.");
+
+  return 0;
+}();
+
+//! @test Verify the traversal of an empty container.
+[[maybe_unused]] auto empty = []() {
+  fcarouge::tree_int vire_chestnut;
+
+  assert(fcarouge::breadth_first_begin(vire_chestnut) ==
+             fcarouge::breadth_first_end(vire_chestnut) &&
+         "The traversal of an empty container must be empty.");
+
+  return 0;
+}();
+
+} // namespace
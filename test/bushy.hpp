@@ -0,0 +1,79 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#ifndef FCAROUGE_BUSHY_HPP
+#define FCAROUGE_BUSHY_HPP
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include <cstddef>
+// std::size_t
+
+#include <vector>
+// std::vector
+
+//! @namespace fcarouge Francois Carouge's projects namespace. Lowers the name
+//! conflict probability in large projects. Use using-declarations or
+//! namespace-alias-definition per your project guidelines.
+namespace fcarouge
+{
+//! @brief Builds a bushy container of consecutive values.
+//!
+//! @details The elements are pushed in breadth-first order, every element
+//! being the parent of the next `arity` elements. The values follow the
+//! breadth-first order from the first value.
+//!
+//! @tparam Tree The type of the container to build.
+//!
+//! @param count The number of elements of the container.
+//! @param first The value of the root element.
+//! @param arity The number of children of the internal elements.
+//!
+//! @return The bushy container.
+template <typename Tree = tree<int>>
+Tree bushy(std::size_t count, typename Tree::value_type first = 0,
+           std::size_t arity = 3)
+{
+  Tree container;
+  std::vector<typename Tree::iterator> positions;
+  typename Tree::value_type value{ first };
+  for (std::size_t index = 0; index < count; ++index, ++value) {
+    if (positions.empty()) {
+      positions.push_back(container.emplace(container.end(), value));
+    } else {
+      positions.push_back(
+          container.push(positions[(index - 1) / arity], value));
+    }
+  }
+
+  return container;
+}
+} // namespace fcarouge
+
+#endif // FCAROUGE_BUSHY_HPP
@@ -0,0 +1,110 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_view.hpp"
+// fcarouge::children
+
+#include <algorithm>
+// std::ranges::equal
+
+#include <cassert>
+// assert
+
+#include <memory_resource>
+// std::pmr::monotonic_buffer_resource std::pmr::polymorphic_allocator
+
+#include <ranges>
+// std::ranges::empty std::ranges::forward_range std::ranges::view
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @test Verify the view meet the forward range and view concepts.
+[[maybe_unused]] constexpr auto concepts = []() {
+  using view = decltype(fcarouge::children(fcarouge::tree<int>::iterator{}));
+  static_assert(std::ranges::view<view>,
+                "The container's children view must meet the view concept.");
+  static_assert(std::ranges::forward_range<view>,
+                "The container's children view must meet the forward range "
+                "concept.");
+
+  return 0;
+}();
+
+//! @test Verify the children of the elements.
+[[maybe_unused]] auto family = []() {
+  fcarouge::tree_int falaise_walnut(0);
+  const auto node1 = falaise_walnut.push(falaise_walnut.begin(), 1);
+  falaise_walnut.push(falaise_walnut.push(node1, 11), 111);
+  falaise_walnut.push(node1, 12);
+  const auto node2 = falaise_walnut.push(falaise_walnut.begin(), 2);
+
+  assert(std::ranges::equal(fcarouge::children(falaise_walnut.begin()),
+                            std::vector{ 1, 2 }) &&
+         "The children of the root must meet requirements.");
+  assert(std::ranges::equal(fcarouge::children(node1), std::vector{ 11, 12 }) &&
+         "The grandchildren must not be viewed.");
+  assert(std::ranges::empty(fcarouge::children(node2)) &&
+         "A leaf has no children.");
+
+  for (auto &value : fcarouge::children(falaise_walnut.cbegin())) {
+    static_assert(std::is_same_v<const int &, decltype(value)>,
+                  "The children of a constant iterator must be constant.");
+  }
+
+  return 0;
+}();
+
+//! @test Verify the children of the elements of a container with a
+//! non-default allocator.
+[[maybe_unused]] auto allocator = []() {
+  std::pmr::monotonic_buffer_resource resource;
+  fcarouge::tree<int, std::pmr::polymorphic_allocator<int>> falaise_walnut{
+    std::pmr::polymorphic_allocator<int>{ &resource }
+  };
+  falaise_walnut.emplace(falaise_walnut.end(), 0);
+  const auto node1 = falaise_walnut.push(falaise_walnut.begin(), 1);
+  falaise_walnut.push(node1, 11);
+  falaise_walnut.push(falaise_walnut.begin(), 2);
+
+  assert(std::ranges::equal(fcarouge::children(falaise_walnut.begin()),
+                            std::vector{ 1, 2 }) &&
+         "The children of the root must meet requirements.");
+  assert(std::ranges::equal(fcarouge::children(falaise_walnut.cbegin()),
+                            std::vector{ 1, 2 }) &&
+         "The children of a constant iterator must meet requirements.");
+
+  return 0;
+}();
+
+} // namespace
@@ -29,17 +29,67 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "fcarouge/tree.hpp"
 // fcarouge::tree
 
+#include "fcarouge/tree_view.hpp"
+// fcarouge::children
+
 #include <cassert>
 // assert
 
+#include <cstddef>
+// std::size_t
+
+#include <memory>
+// std::allocator std::to_address
+
+#include <new>
+// std::bad_alloc
+
 #include <set>
 // std::multiset
 
 #include <type_traits>
 // std::is_copy_constructible_v
 
+#include <vector>
+// std::vector
+
 namespace
 {
+//! @brief The number of live allocations of the bounded allocators.
+std::size_t live_allocations{ 0 };
+
+//! @brief An allocator failing the allocations of more than a few objects.
+template <typename Type> struct bounded_allocator {
+  using value_type = Type;
+
+  bounded_allocator() = default;
+
+  template <typename OtherType>
+  constexpr bounded_allocator(
+      const bounded_allocator<OtherType> &) noexcept
+  {
+  }
+
+  [[nodiscard]] Type *allocate(std::size_t count)
+  {
+    if (count > 16) {
+      throw std::bad_alloc{};
+    }
+    Type *pointer{ std::allocator<Type>{}.allocate(count) };
+    ++live_allocations;
+    return pointer;
+  }
+
+  void deallocate(Type *pointer, std::size_t count)
+  {
+    std::allocator<Type>{}.deallocate(pointer, count);
+    --live_allocations;
+  }
+
+  friend bool operator==(const bounded_allocator &,
+                         const bounded_allocator &) = default;
+};
+
 //! @test Verify the copy construction exists and its exception specification.
 [[maybe_unused]] constexpr auto traits = []() {
   // The container cannot satisty trivial copy construction because it is not a
@@ -132,4 +182,155 @@ namespace
   return 0;
 }();
 
+//! @test Verify the pre-order traversal of a copied deep tree.
+[[maybe_unused]] auto deep = []() {
+  fcarouge::tree<int> auffay_linden(0);
+  auffay_linden.push(
+      auffay_linden.push(auffay_linden.push(auffay_linden.begin(), 1), 11),
+      111);
+  auffay_linden.push(auffay_linden.push(auffay_linden.begin(), 2), 21);
+  const fcarouge::tree<int> allouville_oak(auffay_linden);
+
+  const std::vector<int> expected_content{ 0, 1, 11, 111, 2, 21 };
+  const std::vector<int> content(allouville_oak.begin(), allouville_oak.end());
+
+  assert(expected_content == content &&
+         "The copied container must be traversed in the same pre-order.");
+
+  return 0;
+}();
+
+//! @test Verify the copied elements are laid out in pre-order.
+[[maybe_unused]] auto layout = []() {
+  fcarouge::tree<int> auffay_linden(0);
+  auffay_linden.push(
+      auffay_linden.push(auffay_linden.push(auffay_linden.begin(), 1), 11),
+      111);
+  auffay_linden.push(auffay_linden.push(auffay_linden.begin(), 2), 21);
+  auffay_linden.push(auffay_linden.begin(), 3);
+  const fcarouge::tree<int> allouville_oak(auffay_linden);
+
+  const auto *previous{ std::to_address(allouville_oak.begin()) };
+  const auto stride{ std::to_address(++allouville_oak.begin()) - previous };
+  for (auto position = ++allouville_oak.begin();
+       position != allouville_oak.end(); ++position) {
+    assert(std::to_address(position) - previous == stride &&
+           "The copied elements are contiguous in pre-order.");
+    previous = std::to_address(position);
+  }
+
+  return 0;
+}();
+
+//! @test Verify the copy with an allocator failing large allocations.
+[[maybe_unused]] auto bounded = []() {
+  fcarouge::tree<int, bounded_allocator<int>> auffay_linden(0);
+  auto position{ auffay_linden.begin() };
+  for (int i = 1; i < 100; ++i) {
+    position = auffay_linden.push(i % 7 ? position : auffay_linden.begin(), i);
+  }
+  const fcarouge::tree<int, bounded_allocator<int>> allouville_oak(
+      auffay_linden);
+
+  assert(auffay_linden == allouville_oak &&
+         "The copy is allocated in several blocks.");
+
+  return 0;
+}();
+
+//! @test Verify the blocks of a copy are deallocated once vacated.
+[[maybe_unused]] auto vacated = []() {
+  fcarouge::tree<int, bounded_allocator<int>> auffay_linden(0);
+  for (int i = 1; i < 100; ++i) {
+    auffay_linden.push(auffay_linden.begin(), i);
+  }
+  const std::size_t allocations{ live_allocations };
+  {
+    fcarouge::tree<int, bounded_allocator<int>> allouville_oak(auffay_linden);
+    while (allouville_oak.size() > 1) {
+      allouville_oak.erase(++allouville_oak.begin());
+    }
+
+    assert(allocations + 2 == live_allocations &&
+           "Only the block of the root remains allocated.");
+
+    allouville_oak.push(allouville_oak.begin(), 1);
+    assert(2 == allouville_oak.size() && "The vacated copy is modifiable.");
+  }
+  assert(allocations == live_allocations &&
+         "The blocks are deallocated with the copy.");
+
+  return 0;
+}();
+
+//! @test Verify the copies of a copy, bulk copied when unmodified.
+[[maybe_unused]] auto bulk = []() {
+  fcarouge::tree<int> auffay_linden(0);
+  std::vector<fcarouge::tree<int>::iterator> positions{ auffay_linden.begin() };
+  for (int i = 1; i < 40000; ++i) {
+    positions.push_back(auffay_linden.push(
+        positions[static_cast<std::size_t>(i - 1) / 3], i));
+  }
+  const auto shape = [](const fcarouge::tree<int> &container) {
+    std::vector<std::size_t> counts;
+    for (auto position = container.begin(); position != container.end();
+         ++position) {
+      std::size_t count{ 0 };
+      for ([[maybe_unused]] const int child : fcarouge::children(position)) {
+        ++count;
+      }
+      counts.push_back(count);
+    }
+    return counts;
+  };
+
+  fcarouge::tree<int> allouville_oak(auffay_linden);
+  fcarouge::tree<int> bunodiere_beech(allouville_oak);
+  assert(auffay_linden == bunodiere_beech &&
+         "The copy of a copy has the values of the tree in pre-order.");
+  assert(shape(auffay_linden) == shape(bunodiere_beech) &&
+         "The copy of a copy has the hierarchy of the tree.");
+
+  bunodiere_beech.front() = 42;
+  assert(0 == allouville_oak.front() && "The copies are independent.");
+
+  allouville_oak.erase(++allouville_oak.begin());
+  allouville_oak.push(allouville_oak.begin(), 40000);
+  const fcarouge::tree<int> auzebosc_oak(allouville_oak);
+  assert(allouville_oak == auzebosc_oak &&
+         "The copy of a modified copy has its values in pre-order.");
+  assert(shape(allouville_oak) == shape(auzebosc_oak) &&
+         "The copy of a modified copy has its hierarchy.");
+
+  return 0;
+}();
+
+//! @test Verify the hierarchy of a copied tree with leaves followed by
+//! siblings.
+[[maybe_unused]] auto hierarchy = []() {
+  fcarouge::tree<int> auffay_linden(0);
+  const fcarouge::tree<int>::iterator node1 =
+      auffay_linden.push(auffay_linden.begin(), 1);
+  auffay_linden.push(node1, 11);
+  auffay_linden.push(node1, 12);
+  auffay_linden.push(auffay_linden.begin(), 2);
+  const fcarouge::tree<int> allouville_oak(auffay_linden);
+
+  std::vector<int> root_children;
+  for (const int value : fcarouge::children(allouville_oak.begin())) {
+    root_children.push_back(value);
+  }
+  std::vector<int> node1_children;
+  for (const int value : fcarouge::children(++allouville_oak.begin())) {
+    node1_children.push_back(value);
+  }
+
+  assert((std::vector<int>{ 1, 2 }) == root_children &&
+         "The copied root must have the same children.");
+  assert((std::vector<int>{ 11, 12 }) == node1_children &&
+         "The copied leaves must remain siblings.");
+
+  return 0;
+}();
+
 } // namespace
@@ -0,0 +1,275 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree.hpp"
+// fcarouge::node_policy fcarouge::tree
+
+#include "fcarouge/tree_execution.hpp"
+// fcarouge::par fcarouge::parallel_policy
+
+#include "fcarouge/tree_view.hpp"
+// fcarouge::children
+
+#include "bushy.hpp"
+// fcarouge::bushy
+
+#include <cassert>
+// assert
+
+#include <cstddef>
+// std::size_t
+
+#include <memory>
+// std::allocator
+
+#include <stdexcept>
+// std::runtime_error
+
+#include <type_traits>
+// std::is_constructible_v
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @brief The number of live allocations of the counted allocators.
+std::size_t live_allocations{ 0 };
+
+//! @brief An allocator counting its live allocations.
+template <typename Type> struct counted_allocator {
+  using value_type = Type;
+
+  counted_allocator() = default;
+
+  template <typename OtherType>
+  constexpr counted_allocator(const counted_allocator<OtherType> &) noexcept
+  {
+  }
+
+  [[nodiscard]] Type *allocate(std::size_t count)
+  {
+    Type *pointer{ std::allocator<Type>{}.allocate(count) };
+    ++live_allocations;
+    return pointer;
+  }
+
+  void deallocate(Type *pointer, std::size_t count)
+  {
+    std::allocator<Type>{}.deallocate(pointer, count);
+    --live_allocations;
+  }
+
+  friend bool operator==(const counted_allocator &,
+                         const counted_allocator &) = default;
+};
+
+//! @brief Collects the number of children of every element in pre-order.
+template <typename Tree> std::vector<std::size_t> shape(const Tree &container)
+{
+  std::vector<std::size_t> counts;
+  for (auto position = container.begin(); position != container.end();
+       ++position) {
+    std::size_t count{ 0 };
+    for ([[maybe_unused]] const auto &child : fcarouge::children(position)) {
+      ++count;
+    }
+    counts.push_back(count);
+  }
+
+  return counts;
+}
+
+//! @brief An element throwing on its copy from the given value.
+struct fragile {
+  explicit fragile(int data) : value{ data }
+  {
+  }
+
+  fragile(const fragile &other) : value{ other.value }
+  {
+    if (value == 4321) {
+      throw std::runtime_error{ "4321" };
+    }
+  }
+
+  fragile(fragile &&other) = default;
+
+  int value;
+};
+
+//! @test Verify the parallel copy construction exists.
+[[maybe_unused]] constexpr auto traits = []() {
+  static_assert(std::is_constructible_v<fcarouge::tree<char>,
+                                        const fcarouge::parallel_policy &,
+                                        const fcarouge::tree<char> &>,
+                "The container must be copy constructible in parallel.");
+
+  return 0;
+}();
+
+//! @test Verify the parallel copy of an empty tree.
+[[maybe_unused]] auto empty = []() {
+  const fcarouge::tree<int> auffay_linden;
+  const fcarouge::tree<int> bunodiere_beech(fcarouge::par, auffay_linden);
+
+  assert(bunodiere_beech.empty() && "The container must be empty.");
+  assert(bunodiere_beech.begin() == bunodiere_beech.end() &&
+         "The container's beginning and ending iterators must be equal.");
+
+  return 0;
+}();
+
+//! @test Verify the parallel copy matches the copied tree, in values and
+//! hierarchy.
+[[maybe_unused]] auto bushy_copy = []() {
+  const fcarouge::tree<int> auffay_linden{ fcarouge::bushy(20000) };
+
+  for (const std::size_t concurrency : { 1, 2, 4, 7 }) {
+    const fcarouge::tree<int> bunodiere_beech(
+        fcarouge::parallel_policy{ concurrency }, auffay_linden);
+
+    assert(auffay_linden.size() == bunodiere_beech.size() &&
+           "The copy has the size of the copied tree.");
+    assert(auffay_linden == bunodiere_beech &&
+           "The copy has the values of the copied tree in pre-order.");
+    assert(shape(auffay_linden) == shape(bunodiere_beech) &&
+           "The copy has the hierarchy of the copied tree.");
+  }
+
+  return 0;
+}();
+
+//! @test Verify the slabs of the parallel copy are carved from a few blocks.
+[[maybe_unused]] auto blocks = []() {
+  using tree = fcarouge::tree<int, counted_allocator<int>>;
+  const tree auffay_linden{ fcarouge::bushy<tree>(1000) };
+  const std::size_t allocations{ live_allocations };
+  const tree bunodiere_beech(fcarouge::parallel_policy{ 1 }, auffay_linden);
+
+  assert(allocations + 3 == live_allocations &&
+         "The copy allocates its root and a single block of nodes.");
+  assert(auffay_linden == bunodiere_beech &&
+         "The copy has the values of the copied tree in pre-order.");
+
+  return 0;
+}();
+
+//! @test Verify the parallel copy of a chain.
+[[maybe_unused]] auto chain = []() {
+  fcarouge::tree<int> auffay_linden{ 0 };
+  auto position{ auffay_linden.begin() };
+  for (int i = 1; i < 1000; ++i) {
+    position = auffay_linden.push(position, i);
+  }
+
+  const fcarouge::tree<int> bunodiere_beech(fcarouge::par, auffay_linden);
+
+  assert(auffay_linden == bunodiere_beech &&
+         "The copy has the values of the copied tree in pre-order.");
+
+  return 0;
+}();
+
+//! @test Verify the modifications of a parallel copy.
+[[maybe_unused]] auto modification = []() {
+  const fcarouge::tree<int> auffay_linden{ fcarouge::bushy(1000) };
+  fcarouge::tree<int> bunodiere_beech(fcarouge::parallel_policy{ 3 },
+                                      auffay_linden);
+  fcarouge::tree<int> sequenced_beech(auffay_linden);
+
+  for (fcarouge::tree<int> *beech : { &bunodiere_beech, &sequenced_beech }) {
+    beech->erase(++beech->begin());
+    beech->push(beech->begin(), 1000);
+    beech->emplace(beech->begin(), -1);
+  }
+  assert(sequenced_beech == bunodiere_beech &&
+         "The parallel copy is modified as the sequenced copy.");
+  assert(sequenced_beech.size() == bunodiere_beech.size() &&
+         "The erased and inserted elements are accounted for.");
+
+  fcarouge::tree<int> allouville_oak{ std::move(bunodiere_beech) };
+  assert(-1 == allouville_oak.front() && "The moved copy is kept.");
+  allouville_oak = auffay_linden;
+  assert(auffay_linden == allouville_oak && "The assigned copy is kept.");
+  allouville_oak.clear();
+  assert(allouville_oak.empty() && "The cleared copy is empty.");
+
+  return 0;
+}();
+
+//! @test Verify the exception of an element copy is rethrown and the copied
+//! elements are destroyed.
+[[maybe_unused]] auto exception = []() {
+  fcarouge::tree<fragile> auffay_linden{ fragile{ 0 } };
+  std::vector<fcarouge::tree<fragile>::iterator> positions{
+    auffay_linden.begin()
+  };
+  for (int i = 1; i < 5000; ++i) {
+    positions.push_back(auffay_linden.push(
+        positions[static_cast<std::size_t>(i - 1) / 3], fragile{ i }));
+  }
+
+  bool thrown{ false };
+  try {
+    const fcarouge::tree<fragile> bunodiere_beech(
+        fcarouge::parallel_policy{ 4 }, auffay_linden);
+  } catch (const std::runtime_error &) {
+    thrown = true;
+  }
+  assert(thrown && "The exception is rethrown.");
+
+  return 0;
+}();
+//! @test Verify the parallel copy of a container threading its nodes to their
+//! pre-order successors, and the modifications of the copy.
+[[maybe_unused]] auto threaded = []() {
+  using tree =
+      fcarouge::tree<int, std::allocator<int>,
+                     fcarouge::node_policy<false, false, true>>;
+  const tree auffay_linden{ fcarouge::bushy<tree>(5000) };
+  tree bunodiere_beech(fcarouge::parallel_policy{ 4 }, auffay_linden);
+  tree sequenced_beech(auffay_linden);
+
+  assert(auffay_linden == bunodiere_beech &&
+         "The copy has the values of the copied tree in pre-order.");
+  assert(shape(auffay_linden) == shape(bunodiere_beech) &&
+         "The copy has the hierarchy of the copied tree.");
+
+  for (tree *beech : { &bunodiere_beech, &sequenced_beech }) {
+    beech->erase(++beech->begin());
+    beech->push(beech->begin(), 5000);
+    beech->emplace(beech->begin(), -1);
+  }
+  assert(sequenced_beech == bunodiere_beech &&
+         "The threaded parallel copy is modified as the sequenced copy.");
+
+  return 0;
+}();
+
+} // namespace
@@ -0,0 +1,237 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/cow_tree.hpp"
+// fcarouge::cow_tree
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include <algorithm>
+// std::equal
+
+#include <cassert>
+// assert
+
+#include <iterator>
+// std::next
+
+#include <memory>
+// std::addressof
+
+#include <sstream>
+// std::ostringstream
+
+#include <thread>
+// std::jthread
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @test Verify the copies share the nodes until modified.
+//!
+//! @dot
+//! digraph {
+//!   node [shape=circle fontsize="10"];
+//!   1 -> {2, 5}
+//!   2 -> {3, 4}
+//!   5 -> {6}
+//! }
+//! @enddot
+[[maybe_unused]] auto sharing = []() {
+  fcarouge::cow_tree<int> gerberoy_holly;
+  const auto node1 = gerberoy_holly.emplace_front(1);
+  const auto node2 = gerberoy_holly.push(node1, 2);
+  gerberoy_holly.push(node2, 3);
+  gerberoy_holly.push(node2, 4);
+  gerberoy_holly.push(gerberoy_holly.push(gerberoy_holly.begin(), 5), 6);
+  const std::vector<int> expected{ 1, 2, 3, 4, 5, 6 };
+  assert(6 == gerberoy_holly.size() && "The size must meet expectations.");
+  assert(std::equal(gerberoy_holly.begin(), gerberoy_holly.end(),
+                    expected.begin(), expected.end()) &&
+         "The elements must be traversed in pre-order.");
+  assert(!gerberoy_holly.shared() && "The tree is not shared.");
+
+  fcarouge::cow_tree<int> gournay_holly{ gerberoy_holly };
+  assert(gerberoy_holly.shared() && gournay_holly.shared() &&
+         "The copies must share the nodes.");
+  assert(std::addressof(*gerberoy_holly.begin()) ==
+             std::addressof(*gournay_holly.begin()) &&
+         "The copies must share the nodes.");
+  assert(gerberoy_holly == gournay_holly && "The copies must be equal.");
+
+  // Modify the value 4 of the copy: the path 1, 2, 4 is cloned.
+  const auto node4 = std::next(gournay_holly.begin(), 3);
+  gournay_holly.modify(node4, [](int &value) { value = 42; });
+  assert(4 == *std::next(gerberoy_holly.begin(), 3) &&
+         "The original must not be modified.");
+  assert(42 == *std::next(gournay_holly.begin(), 3) &&
+         "The copy must be modified.");
+  assert(!gerberoy_holly.shared() && !gournay_holly.shared() &&
+         "The roots must be cloned.");
+  for (const auto position : { 0, 1, 3 }) {
+    assert(std::addressof(*std::next(gerberoy_holly.begin(), position)) !=
+               std::addressof(*std::next(gournay_holly.begin(), position)) &&
+           "The path to the modified node must be cloned.");
+  }
+  for (const auto position : { 2, 4, 5 }) {
+    assert(std::addressof(*std::next(gerberoy_holly.begin(), position)) ==
+               std::addressof(*std::next(gournay_holly.begin(), position)) &&
+           "The other subtrees must remain shared.");
+  }
+
+  // Modify the copy again: the owned path is not cloned again.
+  const auto *address = std::addressof(*std::next(gournay_holly.begin(), 3));
+  gournay_holly.modify(std::next(gournay_holly.begin(), 3),
+                       [](int &value) { value = 43; });
+  assert(address == std::addressof(*std::next(gournay_holly.begin(), 3)) &&
+         "The owned nodes must be modified in place.");
+
+  return 0;
+}();
+
+//! @test Verify the modifiers follow the tree modifiers and leave the copies
+//! unchanged.
+[[maybe_unused]] auto modifiers = []() {
+  fcarouge::tree<int> forges_yew;
+  fcarouge::cow_tree<int> forges_holly;
+  forges_yew.emplace(forges_yew.end(), 1);
+  forges_holly.emplace(forges_holly.end(), 1);
+  forges_yew.push(forges_yew.begin(), 2);
+  forges_holly.push(forges_holly.begin(), 2);
+  forges_yew.push(forges_yew.end(), 3);
+  forges_holly.push(forges_holly.end(), 3);
+  const fcarouge::cow_tree<int> neufchatel_holly{ forges_holly };
+
+  forges_yew.emplace(std::next(forges_yew.begin(), 2), 4);
+  forges_holly.emplace(std::next(forges_holly.begin(), 2), 4);
+  forges_yew.push(std::next(forges_yew.begin(), 2), 5);
+  forges_holly.push(std::next(forges_holly.begin(), 2), 5);
+  forges_yew.emplace(forges_yew.begin(), 0);
+  forges_holly.emplace(forges_holly.begin(), 0);
+  forges_yew.emplace_front(-1);
+  forges_holly.emplace_front(-1);
+  assert(forges_yew.size() == forges_holly.size() &&
+         "The size must follow the tree.");
+  assert(std::equal(forges_yew.begin(), forges_yew.end(),
+                    forges_holly.begin(), forges_holly.end()) &&
+         "The elements must follow the tree.");
+
+  const auto next_yew = forges_yew.erase(std::next(forges_yew.begin(), 4));
+  const auto next_holly =
+      forges_holly.erase(std::next(forges_holly.begin(), 4));
+  assert(*next_yew == *next_holly && "The erasure must return the next node.");
+  assert(forges_yew.size() == forges_holly.size() &&
+         "The size must follow the tree.");
+  assert(std::equal(forges_yew.begin(), forges_yew.end(),
+                    forges_holly.begin(), forges_holly.end()) &&
+         "The elements must follow the tree.");
+  assert(forges_holly.end() ==
+             forges_holly.erase(std::next(forges_holly.begin(), 4)) &&
+         "The erasure of the last node must return the end.");
+
+  const std::vector<int> expected{ 1, 2, 3 };
+  assert(std::equal(neufchatel_holly.begin(), neufchatel_holly.end(),
+                    expected.begin(), expected.end()) &&
+         "The copy must not be modified.");
+
+  forges_holly.erase(forges_holly.begin());
+  assert(forges_holly.empty() &&
+         "The erasure of the root must empty the tree.");
+  assert(3 == neufchatel_holly.size() && "The copy must not be modified.");
+
+  return 0;
+}();
+
+//! @test Verify the human-interpretable representation follows the tree
+//! representation.
+[[maybe_unused]] auto insertion = []() {
+  fcarouge::tree_int gouy_yew(0);
+  gouy_yew.push(gouy_yew.push(gouy_yew.push(gouy_yew.begin(), 1), 11), 111);
+  gouy_yew.push(gouy_yew.begin(), 2);
+  gouy_yew.push(gouy_yew.begin(), 3);
+  const auto it = gouy_yew.push(gouy_yew.begin(), 5);
+  gouy_yew.emplace(gouy_yew.push(gouy_yew.push(it, 51), 512), 511);
+  gouy_yew.emplace(gouy_yew.push(gouy_yew.push(it, 52), 522), 521);
+  gouy_yew.push(gouy_yew.push(gouy_yew.push(it, 53), 532), 5321);
+  const fcarouge::cow_tree<int> gouy_holly{ gouy_yew };
+  assert(gouy_yew.size() == gouy_holly.size() &&
+         "The size must follow the tree.");
+
+  std::ostringstream yew_stream;
+  yew_stream << gouy_yew;
+  std::ostringstream holly_stream;
+  holly_stream << gouy_holly;
+  assert(yew_stream.str() == holly_stream.str() &&
+         "The representation must follow the tree representation.");
+
+  std::ostringstream empty_stream;
+  empty_stream << fcarouge::cow_tree<int>{};
+  assert(empty_stream.str().empty() &&
+         "The representation of the empty tree must be empty.");
+
+  return 0;
+}();
+
+//! @test Verify the copies are modified concurrently.
+[[maybe_unused]] auto concurrency = []() {
+  fcarouge::cow_tree<int> lyons_holly;
+  auto position = lyons_holly.emplace_front(0);
+  for (int value = 1; value < 64; ++value) {
+    position = lyons_holly.push(position, value);
+    lyons_holly.push(position, -value);
+  }
+
+  std::vector<fcarouge::cow_tree<int>> copies(4, lyons_holly);
+  {
+    std::vector<std::jthread> threads;
+    for (auto &copy : copies) {
+      threads.emplace_back([&copy]() {
+        for (int repeat = 0; repeat < 100; ++repeat) {
+          fcarouge::cow_tree<int> lyons_yew{ copy };
+          lyons_yew.modify(std::next(lyons_yew.begin(), 100),
+                           [](int &value) { ++value; });
+          copy = lyons_yew;
+        }
+      });
+    }
+  }
+
+  for (const auto &copy : copies) {
+    assert(*std::next(lyons_holly.begin(), 100) + 100 ==
+               *std::next(copy.begin(), 100) &&
+           "Every copy must be modified.");
+  }
+  assert(127 == lyons_holly.size() && "The original must not be modified.");
+
+  return 0;
+}();
+
+} // namespace
@@ -27,7 +27,7 @@ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
 CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "fcarouge/tree.hpp"
-// fcarouge::tree
+// fcarouge::node_policy fcarouge::par fcarouge::tree
 
 #include "fcarouge/tree_algorithm.hpp"
 // fcarouge::depth
@@ -35,9 +35,18 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <cassert>
 // assert
 
+#include <cstddef>
+// std::ptrdiff_t
+
+#include <memory>
+// std::allocator
+
 #include <set>
 // std::multiset
 
+#include <vector>
+// std::vector
+
 namespace
 {
 //! @test Verify the depth of the root on a constant container.
@@ -99,4 +108,74 @@ namespace
   return 0;
 }();
 
+//! @test Verify the cached depth of all the nodes of a complex container.
+//!
+//! @details The container caches the levels of its nodes with the level node
+//! policy. The container is grown from the leaves up to a new root to verify
+//! the cached levels remain relative to the root.
+//!
+//! @dot
+//! digraph {
+//!   node [shape=circle fontsize="10"];
+//!   -1 -> {0}
+//!   0 -> {1, 2}
+//!   1 -> {11, 12}
+//!   2 -> {21}
+//! }
+//! @enddot
+[[maybe_unused]] auto cached = []() {
+  using tree_type =
+      fcarouge::tree<int, std::allocator<int>, fcarouge::node_policy<true>>;
+
+  tree_type auffay_linden(0);
+  const tree_type::iterator node1 =
+      auffay_linden.push(auffay_linden.begin(), 1);
+  auffay_linden.emplace(auffay_linden.push(node1, 12), 11);
+  auffay_linden.push(auffay_linden.insert(auffay_linden.end(), 2), 21);
+  auffay_linden.push_front(-1);
+
+  for (auto iterator = auffay_linden.cbegin(); iterator != auffay_linden.cend();
+       ++iterator) {
+    assert(depth(iterator) == depth(auffay_linden, iterator) &&
+           "The cached depth must be equal to the walked depth.");
+  }
+
+  const tree_type copy_linden(auffay_linden);
+  for (auto iterator = copy_linden.cbegin(); iterator != copy_linden.cend();
+       ++iterator) {
+    assert(depth(iterator) == depth(copy_linden, iterator) &&
+           "The cached depth of a copy must be equal to the walked depth.");
+  }
+
+  const tree_type parallel_linden(fcarouge::par, auffay_linden);
+  for (auto iterator = parallel_linden.cbegin();
+       iterator != parallel_linden.cend(); ++iterator) {
+    assert(depth(iterator) == depth(parallel_linden, iterator) &&
+           "The cached depth of a parallel copy must be equal to the walked "
+           "depth.");
+  }
+
+  return 0;
+}();
+
+//! @test Verify the depth of the nodes of a container without cached levels.
+//!
+//! @details The container of the default node policy walks the ancestors.
+[[maybe_unused]] auto walked = []() {
+  fcarouge::tree<int> auffay_oak(0);
+  auffay_oak.push(auffay_oak.push(auffay_oak.begin(), 1), 11);
+  auffay_oak.push_front(-1);
+
+  std::vector<std::ptrdiff_t> depths;
+  for (auto iterator = auffay_oak.cbegin(); iterator != auffay_oak.cend();
+       ++iterator) {
+    depths.push_back(depth(auffay_oak, iterator));
+  }
+  assert((depths == std::vector<std::ptrdiff_t>{ 0, 1, 2, 3 }) &&
+         "The walked depths of the container elements must meet "
+         "requirements.");
+
+  return 0;
+}();
+
 } // namespace
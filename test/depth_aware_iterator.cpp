@@ -0,0 +1,125 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_algorithm.hpp"
+// fcarouge::depth
+
+#include "fcarouge/tree_iterator.hpp"
+// fcarouge::depth_aware_iterator
+
+#include <algorithm>
+// std::equal
+
+#include <cassert>
+// assert
+
+#include <iterator>
+// std::forward_iterator
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @test Verify the iterator meet the forward iterator concept.
+[[maybe_unused]] constexpr auto forward_iterator = []() {
+  static_assert(
+      std::forward_iterator<fcarouge::depth_aware_iterator<int>>,
+      "The container's depth-aware iterator must meet the forward iterator "
+      "concept.");
+
+  return 0;
+}();
+
+//! @test Verify the order and the tracked depths of the depth-aware iterator.
+[[maybe_unused]] auto iterate = []() {
+  fcarouge::tree_int bolbec_alder(0);
+  bolbec_alder.push(
+      bolbec_alder.push(bolbec_alder.push(bolbec_alder.begin(), 1), 11), 111);
+  bolbec_alder.push(bolbec_alder.begin(), 2);
+  const auto it = bolbec_alder.push(bolbec_alder.begin(), 3);
+  bolbec_alder.emplace(bolbec_alder.push(bolbec_alder.push(it, 31), 312), 311);
+  bolbec_alder.push(it, 32);
+
+  // 0
+  // ├── 1
+  // │   └── 11
+  // │       └── 111
+  // ├── 2
+  // └── 3
+  //     ├── 31
+  //     │   ├── 311
+  //     │   └── 312
+  //     └── 32
+
+  const std::vector<int> expected_content{ 0,  1,   11,  111, 2,
+                                           3,  31,  311, 312, 32 };
+  const std::vector<int> expected_depths{ 0, 1, 2, 3, 1, 1, 2, 3, 3, 2 };
+
+  std::vector<int> content;
+  std::vector<int> depths;
+  for (fcarouge::depth_aware_iterator<int> iterator = bolbec_alder.begin(),
+                                           end = bolbec_alder.end();
+       iterator != end; ++iterator) {
+    content.push_back(*iterator);
+    depths.push_back(static_cast<int>(depth(iterator)));
+  }
+
+  assert(expected_content == content &&
+         "The depth-aware traversal must meet requirements.");
+  assert(expected_depths == depths &&
+         "The tracked depths must meet requirements.");
+
+  return 0;
+}();
+
+//! @test Verify the depth of an iterator starting from an inner node.
+[[maybe_unused]] auto inner = []() {
+  fcarouge::tree_int bolbec_alder(0);
+  const auto node11 =
+      bolbec_alder.push(bolbec_alder.push(bolbec_alder.begin(), 1), 11);
+  bolbec_alder.push(node11, 111);
+  bolbec_alder.push(bolbec_alder.begin(), 2);
+
+  fcarouge::depth_aware_iterator<int> iterator = node11;
+  assert(2 == depth(iterator) &&
+         "The initial depth must be equal to the node depth.");
+  ++iterator;
+  assert(111 == *iterator && 3 == depth(iterator) &&
+         "The depth must increase when descending.");
+  iterator++;
+  assert(2 == *iterator && 1 == depth(iterator) &&
+         "The depth must decrease when climbing.");
+
+  return 0;
+}();
+
+} // namespace
@@ -0,0 +1,138 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_iterator.hpp"
+// fcarouge::depth_first_post_order_iterator fcarouge::post_order_begin
+// fcarouge::post_order_end
+
+#include <algorithm>
+// std::equal
+
+#include <cassert>
+// assert
+
+#include <iterator>
+// std::forward_iterator
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @test Verify the iterator meet the forward iterator concept.
+[[maybe_unused]] constexpr auto forward_iterator = []() {
+  static_assert(
+      std::forward_iterator<fcarouge::depth_first_post_order_iterator<int>>,
+      "The container's depth first post-order iterator must meet the forward "
+      "iterator concept.");
+
+  return 0;
+}();
+
+//! @test Verify the order of the depth first post-order iterator.
+[[maybe_unused]] auto iterate = []() {
+  fcarouge::tree_int lisieux_elm(0);
+  lisieux_elm.push(
+      lisieux_elm.push(lisieux_elm.push(lisieux_elm.begin(), 1), 11), 111);
+  lisieux_elm.push(lisieux_elm.begin(), 2);
+  lisieux_elm.push(lisieux_elm.begin(), 3);
+  const auto it = lisieux_elm.push(lisieux_elm.begin(), 5);
+  lisieux_elm.emplace(lisieux_elm.push(lisieux_elm.push(it, 51), 512), 511);
+  lisieux_elm.emplace(lisieux_elm.push(lisieux_elm.push(it, 52), 522), 521);
+
+  // 0
+  // ├── 1
+  // │   └── 11
+  // │       └── 111
+  // ├── 2
+  // ├── 3
+  // └── 5
+  //     ├── 51
+  //     │   ├── 511
+  //     │   └── 512
+  //     └── 52
+  //         ├── 521
+  //         └── 522
+
+  const std::vector<int> expected_content{ 111, 11,  1,   2,   3,  511, 512,
+                                           51,  521, 522, 52,  5,  0 };
+
+  assert(std::equal(fcarouge::post_order_begin(lisieux_elm),
+                    fcarouge::post_order_end(lisieux_elm),
+                    expected_content.begin(), expected_content.end()) &&
+         "The depth first post-order traversal must meet requirements.");
+
+  const auto &const_lisieux_elm = lisieux_elm;
+  assert(std::equal(fcarouge::post_order_begin(const_lisieux_elm),
+                    fcarouge::post_order_end(const_lisieux_elm),
+                    expected_content.begin(), expected_content.end()) &&
+         "The constant depth first post-order traversal must meet "
+         "requirements.");
+
+  return 0;
+}();
+
+//! @test Verify the children are visited before their parent to release
+//! resources bottom-up.
+[[maybe_unused]] auto children_first = []() {
+  fcarouge::tree_int lisieux_elm(1);
+  const auto node2 = lisieux_elm.push(lisieux_elm.begin(), 1);
+  lisieux_elm.push(node2, 1);
+  lisieux_elm.push(node2, 1);
+  lisieux_elm.push(lisieux_elm.begin(), 1);
+
+  // Accumulate the sizes of the subtrees from the leaves.
+  for (auto position = fcarouge::post_order_begin(lisieux_elm);
+       position != fcarouge::post_order_end(lisieux_elm); ++position) {
+    if (position.node->parent) {
+      position.node->parent->data += *position;
+    }
+  }
+
+  assert(5 == *lisieux_elm.begin() &&
+         "The root must accumulate the size of the container.");
+  assert(3 == *node2 && "The subtree must accumulate its size.");
+
+  return 0;
+}();
+
+//! @test Verify the traversal of an empty container.
+[[maybe_unused]] auto empty = []() {
+  fcarouge::tree_int lisieux_elm;
+
+  assert(fcarouge::post_order_begin(lisieux_elm) ==
+             fcarouge::post_order_end(lisieux_elm) &&
+         "The traversal of an empty container must be empty.");
+
+  return 0;
+}();
+
+} // namespace
@@ -100,4 +100,35 @@ namespace
   return 0;
 }();
 
+//! @test Verify the decrement of the depth first pre-order iterator descends
+//! the last children of the left sibling.
+[[maybe_unused]] auto decrement = []() {
+  fcarouge::tree_int cerisy_hornbeam(0);
+  const auto it1 = cerisy_hornbeam.push(cerisy_hornbeam.begin(), 1);
+  cerisy_hornbeam.push(cerisy_hornbeam.push(it1, 11), 111);
+  cerisy_hornbeam.push(it1, 12);
+  const auto it2 = cerisy_hornbeam.push(cerisy_hornbeam.begin(), 2);
+
+  // 0
+  // ├── 1
+  // │   ├── 11
+  // │   │   └── 111
+  // │   └── 12
+  // └── 2
+
+  fcarouge::depth_first_pre_order_iterator<int> position = it2;
+  assert(*--position == 12 && "The previous element must be the deepest last "
+                              "descendant of the left sibling.");
+  assert(*--position == 111 &&
+         "The previous element must be the deepest last descendant.");
+  assert(*--position == 11 && "The previous element must be the parent.");
+  assert(*--position == 1 && "The previous element must be the parent.");
+  assert(*position-- == 1 && *position == 0 &&
+         "The postfix decrement must return the current element.");
+  assert(*position++ == 0 && *position == 1 &&
+         "The postfix increment must return the current element.");
+
+  return 0;
+}();
+
 } // namespace
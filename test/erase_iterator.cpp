@@ -27,11 +27,17 @@ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
 CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "fcarouge/tree.hpp"
-// fcarouge::tree
+// fcarouge::node_policy fcarouge::tree
 
 #include <cassert>
 // assert
 
+#include <memory>
+// std::allocator
+
+#include <vector>
+// std::vector
+
 namespace
 {
 //! @test Verify the post-conditions on erasing the sole element of a container.
@@ -140,4 +146,68 @@ namespace
   return 0;
 }();
 
+//! @test Verify the pre-order traversal of a tree modified around an erased
+//! middle element.
+[[maybe_unused]] auto middle = []() {
+  fcarouge::tree<int> allouville_oak(0);
+  const fcarouge::tree<int>::iterator node1 =
+      allouville_oak.push(allouville_oak.begin(), 1);
+  allouville_oak.push(node1, 11);
+  const fcarouge::tree<int>::iterator node2 =
+      allouville_oak.push(allouville_oak.begin(), 2);
+  allouville_oak.push(node2, 21);
+  const fcarouge::tree<int>::iterator node3 =
+      allouville_oak.push(allouville_oak.begin(), 3);
+  const fcarouge::tree<int>::const_iterator iterator =
+      allouville_oak.erase(node2);
+
+  assert(iterator == node3 &&
+         "The iterator following the erased element must be its right "
+         "sibling.");
+
+  allouville_oak.emplace(node3, 4);
+  allouville_oak.push(node1, 12);
+
+  const std::vector<int> expected_content{ 0, 1, 11, 12, 4, 3 };
+  const std::vector<int> content(allouville_oak.begin(), allouville_oak.end());
+
+  assert(expected_content == content &&
+         "The pre-order traversal must skip the erased elements and visit the "
+         "inserted elements.");
+
+  return 0;
+}();
+
+//! @test Verify the pre-order traversal after erasing and inserting elements
+//! of a container threading its nodes to their pre-order successors.
+[[maybe_unused]] auto threaded = []() {
+  using tree =
+      fcarouge::tree<int, std::allocator<int>,
+                     fcarouge::node_policy<false, false, true>>;
+  tree allouville_elm(0);
+  const tree::iterator node1 = allouville_elm.push(allouville_elm.begin(), 1);
+  allouville_elm.push(node1, 11);
+  const tree::iterator node2 = allouville_elm.push(allouville_elm.begin(), 2);
+  allouville_elm.push(node2, 21);
+  const tree::iterator node3 = allouville_elm.push(allouville_elm.begin(), 3);
+  const tree::const_iterator iterator = allouville_elm.erase(node2);
+
+  assert(iterator == node3 &&
+         "The iterator following the erased element must be its right "
+         "sibling.");
+
+  allouville_elm.emplace(node3, 4);
+  allouville_elm.push(node1, 12);
+  allouville_elm.emplace_front(-1);
+
+  const std::vector<int> expected_content{ -1, 0, 1, 11, 12, 4, 3 };
+  const std::vector<int> content(allouville_elm.begin(), allouville_elm.end());
+
+  assert(expected_content == content &&
+         "The threaded pre-order traversal must skip the erased elements and "
+         "visit the inserted elements.");
+
+  return 0;
+}();
+
 } // namespace
@@ -0,0 +1,136 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree_algorithm.hpp"
+// fcarouge::find_if fcarouge::match
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_execution.hpp"
+// fcarouge::par fcarouge::parallel_policy fcarouge::seq
+
+#include "bushy.hpp"
+// fcarouge::bushy
+
+#include <algorithm>
+// std::find_if
+
+#include <cassert>
+// assert
+
+#include <stdexcept>
+// std::runtime_error
+
+namespace
+{
+//! @test Verify the first match in pre-order is found.
+[[maybe_unused]] auto first = []() {
+  const fcarouge::tree<int> saint_wandrille_oak{ fcarouge::bushy(20000) };
+
+  for (const int divisor : { 7, 97, 1009, 4999 }) {
+    const auto predicate = [divisor](int value) {
+      return value > 0 && value % divisor == 0;
+    };
+    const auto expected = std::find_if(saint_wandrille_oak.begin(),
+                                       saint_wandrille_oak.end(), predicate);
+
+    assert(expected == fcarouge::find_if(fcarouge::seq, saint_wandrille_oak,
+                                         predicate) &&
+           "The sequenced search must find the first match in pre-order.");
+    assert(expected == fcarouge::find_if(fcarouge::par, saint_wandrille_oak,
+                                         predicate) &&
+           "The parallel search must find the first match in pre-order.");
+    assert(expected == fcarouge::find_if(fcarouge::parallel_policy{ 4 },
+                                         saint_wandrille_oak, predicate,
+                                         fcarouge::match::first) &&
+           "The parallel search must find the first match in pre-order.");
+  }
+
+  return 0;
+}();
+
+//! @test Verify any match is found.
+[[maybe_unused]] auto any = []() {
+  const fcarouge::tree<int> saint_wandrille_oak{ fcarouge::bushy(20000) };
+  const auto predicate = [](int value) { return value % 1000 == 999; };
+
+  const auto position =
+      fcarouge::find_if(fcarouge::parallel_policy{ 4 }, saint_wandrille_oak,
+                        predicate, fcarouge::match::any);
+
+  assert(position != saint_wandrille_oak.end() && predicate(*position) &&
+         "The parallel search must find a match.");
+  assert(fcarouge::any_of(fcarouge::par, saint_wandrille_oak, predicate) &&
+         "A match must exist.");
+  assert(fcarouge::any_of(fcarouge::seq, saint_wandrille_oak, predicate) &&
+         "A match must exist.");
+
+  return 0;
+}();
+
+//! @test Verify no match is found.
+[[maybe_unused]] auto none = []() {
+  const fcarouge::tree<int> saint_wandrille_oak{ fcarouge::bushy(5000) };
+  const auto predicate = [](int value) { return value < 0; };
+
+  assert(fcarouge::find_if(fcarouge::parallel_policy{ 3 }, saint_wandrille_oak,
+                           predicate) == saint_wandrille_oak.end() &&
+         "The parallel search must not find any match.");
+  assert(!fcarouge::any_of(fcarouge::parallel_policy{ 3 },
+                           saint_wandrille_oak, predicate) &&
+         "No match must exist.");
+  assert(!fcarouge::any_of(fcarouge::par, fcarouge::tree<int>{}, predicate) &&
+         "No match must exist in an empty container.");
+
+  return 0;
+}();
+
+//! @test Verify the exception of a parallel search is rethrown.
+[[maybe_unused]] auto exception = []() {
+  const fcarouge::tree<int> saint_wandrille_oak{ fcarouge::bushy(1000) };
+  bool thrown = false;
+
+  try {
+    static_cast<void>(fcarouge::find_if(
+        fcarouge::parallel_policy{ 4 }, saint_wandrille_oak, [](int value) {
+          if (value == 500) {
+            throw std::runtime_error{ "Stop." };
+          }
+          return false;
+        }));
+  } catch (const std::runtime_error &) {
+    thrown = true;
+  }
+
+  assert(thrown && "The exception of the predicate must be rethrown.");
+
+  return 0;
+}();
+
+} // namespace
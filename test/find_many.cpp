@@ -0,0 +1,121 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree_algorithm.hpp"
+// fcarouge::find_many
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include <algorithm>
+// std::find
+
+#include <cassert>
+// assert
+
+#include <cstddef>
+// std::size_t
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @test Verify the results of interleaved lookups in many containers.
+[[maybe_unused]] auto many = []() {
+  std::vector<fcarouge::tree<int>> forests(5);
+  for (std::size_t i = 0; i < forests.size(); ++i) {
+    fcarouge::tree<int> &brotonne_oak = forests[i];
+    brotonne_oak.emplace(brotonne_oak.end(), 0);
+    for (int j = 1; j <= static_cast<int>(i) * 3; ++j) {
+      brotonne_oak.push(brotonne_oak.push(brotonne_oak.begin(), j), -j);
+    }
+  }
+  forests.emplace_back();
+
+  std::vector<fcarouge::tree<int>::iterator> positions;
+  std::vector<int> values;
+  for (std::size_t i = 0; i < forests.size(); ++i) {
+    for (int value : { 0, 1, -4, 7, 12, -12, 99 }) {
+      positions.push_back(forests[i].begin());
+      values.push_back(value);
+    }
+  }
+
+  std::vector<fcarouge::tree<int>::iterator> results(positions.size());
+  const auto last = fcarouge::find_many<4>(positions, values, results.begin());
+
+  assert(last == results.end() && "Every lookup must have a result.");
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    const fcarouge::tree<int> &brotonne_oak = forests[i / 7];
+    assert(results[i] == std::find(brotonne_oak.begin(), brotonne_oak.end(),
+                                   values[i]) &&
+           "Every result must be the first element equal to its value in "
+           "pre-order.");
+  }
+
+  return 0;
+}();
+
+//! @test Verify the lookups start from their positions.
+[[maybe_unused]] auto start = []() {
+  fcarouge::tree<int> lyons_beech(0);
+  const auto it1 = lyons_beech.push(lyons_beech.begin(), 1);
+  lyons_beech.push(it1, 2);
+  const auto it2 = lyons_beech.push(lyons_beech.begin(), 2);
+
+  const std::vector<fcarouge::tree<int>::const_iterator> positions{
+    lyons_beech.cbegin(), it2, lyons_beech.cend()
+  };
+  const std::vector<int> values{ 2, 2, 2 };
+  std::vector<fcarouge::tree<int>::const_iterator> results(3);
+  fcarouge::find_many(positions, values, results.begin());
+
+  assert(*results[0] == 2 && results[0] != it2 &&
+         "The first equal element in pre-order must be found.");
+  assert(results[1] == it2 && "The lookup must start from its position.");
+  assert(results[2] == lyons_beech.cend() &&
+         "A lookup from the end must not find any element.");
+
+  return 0;
+}();
+
+//! @test Verify no lookups.
+[[maybe_unused]] auto none = []() {
+  const std::vector<fcarouge::tree<int>::iterator> positions;
+  const std::vector<int> values;
+  std::vector<fcarouge::tree<int>::iterator> results;
+
+  assert(fcarouge::find_many(positions, values, results.begin()) ==
+             results.begin() &&
+         "No lookup must write no result.");
+
+  return 0;
+}();
+
+} // namespace
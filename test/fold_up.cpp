@@ -0,0 +1,157 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree_algorithm.hpp"
+// fcarouge::fold_up
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_execution.hpp"
+// fcarouge::par fcarouge::parallel_policy fcarouge::seq
+
+#include "bushy.hpp"
+// fcarouge::bushy
+
+#include <cassert>
+// assert
+
+#include <cstddef>
+// std::size_t
+
+#include <stdexcept>
+// std::runtime_error
+
+#include <string>
+// std::string std::to_string
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @test Verify the sequenced fold of the subtree sizes and of an ordered
+//! combination.
+//!
+//! @dot
+//! digraph {
+//!   node [shape=circle fontsize="10"];
+//!   1 -> {2, 4}
+//!   2 -> {3}
+//! }
+//! @enddot
+[[maybe_unused]] auto sequenced = []() {
+  fcarouge::tree<int> cerisy_chestnut{ 1 };
+  cerisy_chestnut.push(cerisy_chestnut.push(cerisy_chestnut.begin(), 2), 3);
+  cerisy_chestnut.push(cerisy_chestnut.begin(), 4);
+
+  const std::vector<std::size_t> sizes{ fcarouge::fold_up(
+      fcarouge::seq, cerisy_chestnut, [](int) { return std::size_t{ 1 }; },
+      [](std::size_t size, std::size_t child) { return size + child; }) };
+  assert((std::vector<std::size_t>{ 4, 2, 1, 1 }) == sizes &&
+         "The results are the subtree sizes in pre-order.");
+
+  const std::vector<std::string> terms{ fcarouge::fold_up(
+      fcarouge::seq, cerisy_chestnut,
+      [](int value) { return std::to_string(value); },
+      [](std::string term, const std::string &child) {
+        return term + "(" + child + ")";
+      }) };
+  assert((std::vector<std::string>{ "1(2(3))(4)", "2(3)", "3", "4" }) ==
+             terms &&
+         "The children are combined from left to right.");
+
+  return 0;
+}();
+
+//! @test Verify the parallel fold matches the sequenced fold.
+[[maybe_unused]] auto parallel = []() {
+  const fcarouge::tree<int> cerisy_chestnut{ fcarouge::bushy(20000) };
+
+  const auto leaf = [](int value) { return std::size_t(value) * 2654435761u; };
+  const auto combine = [](std::size_t hash, std::size_t child) {
+    return hash * 31 + child;
+  };
+  const std::vector<std::size_t> expected{ fcarouge::fold_up(
+      fcarouge::seq, cerisy_chestnut, leaf, combine) };
+
+  for (const std::size_t concurrency : { 1, 2, 4, 7 }) {
+    assert(fcarouge::fold_up(fcarouge::parallel_policy{ concurrency },
+                             cerisy_chestnut, leaf, combine) == expected &&
+           "The parallel fold matches the sequenced fold.");
+  }
+
+  return 0;
+}();
+
+//! @test Verify the parallel fold of a chain and of an empty container.
+[[maybe_unused]] auto chain = []() {
+  fcarouge::tree<int> cerisy_chestnut;
+  assert(fcarouge::fold_up(fcarouge::par, cerisy_chestnut,
+                           [](int value) { return value; },
+                           [](int fold, int child) { return fold + child; })
+             .empty() &&
+         "The fold of an empty container is empty.");
+
+  auto position{ cerisy_chestnut.emplace(cerisy_chestnut.end(), 0) };
+  for (int i = 1; i < 100; ++i) {
+    position = cerisy_chestnut.push(position, i);
+  }
+
+  const std::vector<int> sums{ fcarouge::fold_up(
+      fcarouge::par, cerisy_chestnut, [](int value) { return value; },
+      [](int fold, int child) { return fold + child; }) };
+  assert(4950 == sums.front() && 99 == sums.back() &&
+         "The chain sums its descendants.");
+
+  return 0;
+}();
+
+//! @test Verify the first exception of a function is rethrown.
+[[maybe_unused]] auto exception = []() {
+  const fcarouge::tree<int> cerisy_chestnut{ fcarouge::bushy(5000) };
+
+  bool thrown{ false };
+  try {
+    [[maybe_unused]] const auto folds{ fcarouge::fold_up(
+        fcarouge::parallel_policy{ 4 }, cerisy_chestnut,
+        [](int value) {
+          if (value == 4321) {
+            throw std::runtime_error{ "4321" };
+          }
+          return value;
+        },
+        [](int fold, int child) { return fold + child; }) };
+  } catch (const std::runtime_error &error) {
+    thrown = error.what() == std::string{ "4321" };
+  }
+  assert(thrown && "The exception is rethrown.");
+
+  return 0;
+}();
+} // namespace
@@ -0,0 +1,141 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree_algorithm.hpp"
+// fcarouge::for_each
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_execution.hpp"
+// fcarouge::par fcarouge::parallel_policy fcarouge::seq
+
+#include "bushy.hpp"
+// fcarouge::bushy
+
+#include <atomic>
+// std::atomic
+
+#include <cassert>
+// assert
+
+#include <cstddef>
+// std::size_t
+
+#include <stdexcept>
+// std::runtime_error
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @test Verify the sequenced traversal visits the elements in pre-order.
+[[maybe_unused]] auto sequenced = []() {
+  fcarouge::tree<int> lillebonne_elm(0);
+  lillebonne_elm.push(lillebonne_elm.push(lillebonne_elm.begin(), 1), 11);
+  lillebonne_elm.push(lillebonne_elm.begin(), 2);
+
+  std::vector<int> content;
+  fcarouge::for_each(fcarouge::seq, lillebonne_elm,
+                     [&content](int &value) { content.push_back(value); });
+
+  assert((content == std::vector<int>{ 0, 1, 11, 2 }) &&
+         "The sequenced traversal must visit the elements in pre-order.");
+
+  return 0;
+}();
+
+//! @test Verify the parallel traversal visits every element exactly once.
+[[maybe_unused]] auto parallel = []() {
+  for (const std::size_t concurrency : { 0U, 1U, 4U }) {
+    fcarouge::tree<int> brotonne_oak{ fcarouge::bushy(10000, 0, 4) };
+    std::vector<std::atomic<int>> visits(10000);
+
+    fcarouge::for_each(fcarouge::parallel_policy{ concurrency }, brotonne_oak,
+                       [&visits](int &value) {
+                         ++visits[static_cast<std::size_t>(value)];
+                         value = -value;
+                       });
+
+    for (const auto &visit : visits) {
+      assert(1 == visit && "Every element must be visited exactly once.");
+    }
+    for (const int value : brotonne_oak) {
+      assert(value <= 0 && "Every element must be modified.");
+    }
+  }
+
+  return 0;
+}();
+
+//! @test Verify the parallel traversal of a chain and of an empty container.
+[[maybe_unused]] auto degenerate = []() {
+  fcarouge::tree<int> londe_pine(0);
+  auto position = londe_pine.begin();
+  for (int i = 1; i < 1000; ++i) {
+    position = londe_pine.push(position, i);
+  }
+  const fcarouge::tree<int> &const_londe_pine = londe_pine;
+  std::atomic<int> sum{ 0 };
+
+  fcarouge::for_each(fcarouge::par, const_londe_pine,
+                     [&sum](const int &value) { sum += value; });
+
+  assert(499500 == sum && "Every element of a chain must be visited.");
+
+  const fcarouge::tree<int> empty;
+  fcarouge::for_each(fcarouge::par, empty, [&sum](const int &) { ++sum; });
+
+  assert(499500 == sum && "No element of an empty container is visited.");
+
+  return 0;
+}();
+
+//! @test Verify the exception of a parallel traversal is rethrown.
+[[maybe_unused]] auto exception = []() {
+  fcarouge::tree<int> brotonne_oak{ fcarouge::bushy(1000, 0, 4) };
+  bool thrown = false;
+
+  try {
+    fcarouge::for_each(fcarouge::parallel_policy{ 4 }, brotonne_oak,
+                       [](const int &value) {
+                         if (value == 500) {
+                           throw std::runtime_error{ "Stop." };
+                         }
+                       });
+  } catch (const std::runtime_error &) {
+    thrown = true;
+  }
+
+  assert(thrown && "The exception of the function must be rethrown.");
+
+  return 0;
+}();
+
+} // namespace
@@ -0,0 +1,167 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_index.hpp"
+// fcarouge::heavy_light_index
+
+#include <algorithm>
+// std::max
+
+#include <cassert>
+// assert
+
+#include <limits>
+// std::numeric_limits
+
+#include <string>
+// std::string std::to_string
+
+namespace
+{
+//! @brief Sums the values of the path from the root by walking the parent
+//! links.
+int walk_sum(fcarouge::tree<int>::const_iterator position)
+{
+  int sum = 0;
+  for (auto *node = position.node; node; node = node->parent) {
+    sum += node->data;
+  }
+
+  return sum;
+}
+
+//! @test Verify the sums of the paths from the root of every node of a complex
+//! container.
+//!
+//! @dot
+//! digraph {
+//!   node [shape=circle fontsize="10"];
+//!   0 -> {1, 2, 3}
+//!   1 -> {11, 12}
+//!   12 -> {121}
+//!   3 -> {31}
+//! }
+//! @enddot
+[[maybe_unused]] auto complex = []() {
+  fcarouge::tree_int honfleur_oak(0);
+  const auto node1 = honfleur_oak.push(honfleur_oak.begin(), 1);
+  honfleur_oak.push(node1, 11);
+  honfleur_oak.push(honfleur_oak.push(node1, 12), 121);
+  honfleur_oak.push(honfleur_oak.begin(), 2);
+  honfleur_oak.push(honfleur_oak.push(honfleur_oak.begin(), 3), 31);
+
+  fcarouge::heavy_light_index index{ honfleur_oak };
+  for (auto position = honfleur_oak.cbegin(); position != honfleur_oak.cend();
+       ++position) {
+    assert(walk_sum(position) == index.path(position) &&
+           "The path aggregate must meet requirements.");
+  }
+
+  return 0;
+}();
+
+//! @test Verify the aggregate of a path between an ancestor and a descendant.
+[[maybe_unused]] auto ancestor = []() {
+  fcarouge::tree_int honfleur_oak(1);
+  const auto node2 = honfleur_oak.push(honfleur_oak.begin(), 2);
+  const auto node3 = honfleur_oak.push(node2, 3);
+  honfleur_oak.push(node2, 30);
+  honfleur_oak.push(node2, 300);
+  const auto node4 = honfleur_oak.push(node3, 4);
+  const auto node5 = honfleur_oak.push(node4, 5);
+
+  fcarouge::heavy_light_index index{ honfleur_oak };
+  assert(3 + 4 + 5 == index.path(node3, node5) &&
+         "The path must include both ends.");
+  assert(2 + 3 + 4 == index.path(node2, node4) &&
+         "The path must include both ends.");
+  assert(4 == index.path(node4, node4) &&
+         "The path of an element to itself is the element.");
+  assert(1 + 2 + 3 + 4 + 5 == index.path(honfleur_oak.begin(), node5) &&
+         "The path from the root must include the root.");
+
+  return 0;
+}();
+
+//! @test Verify the aggregates follow the updated weights and the modified
+//! topology.
+[[maybe_unused]] auto update = []() {
+  fcarouge::tree_int honfleur_oak(1);
+  auto node2 = honfleur_oak.push(honfleur_oak.begin(), 2);
+  auto node3 = honfleur_oak.push(node2, 3);
+  honfleur_oak.push(honfleur_oak.begin(), 20);
+
+  const auto maximum = [](int lhs, int rhs) { return std::max(lhs, rhs); };
+  fcarouge::heavy_light_index index{ honfleur_oak,
+                                     std::numeric_limits<int>::lowest(),
+                                     maximum };
+  assert(3 == index.path(node3) && "The maximum must meet requirements.");
+
+  *node2 = 42;
+  index.update(node2);
+  assert(42 == index.path(node3) &&
+         "The aggregate must follow the updated weight.");
+
+  *node2 = 2;
+  index.update(node2);
+  const auto node4 = honfleur_oak.push(node3, 7);
+  assert(7 == index.path(node4) &&
+         "The aggregate must follow the modified topology.");
+  assert(3 == index.path(node3) &&
+         "The aggregate must follow the modified topology.");
+
+  return 0;
+}();
+
+//! @test Verify a non-commutative operation aggregates from the top.
+[[maybe_unused]] auto order = []() {
+  fcarouge::tree_int honfleur_oak(1);
+  const auto node2 = honfleur_oak.push(honfleur_oak.begin(), 2);
+  const auto node3 = honfleur_oak.push(node2, 3);
+  honfleur_oak.push(node2, 30);
+  const auto node4 = honfleur_oak.push(node3, 4);
+  honfleur_oak.push(honfleur_oak.begin(), 20);
+
+  const auto concatenate = [](const std::string &lhs, const std::string &rhs) {
+    return lhs + rhs;
+  };
+  const auto to_string = [](int value) { return std::to_string(value); };
+  fcarouge::heavy_light_index index{ honfleur_oak, std::string{}, concatenate,
+                                     to_string };
+  assert("1234" == index.path(node4) &&
+         "The aggregate must follow the path from the root.");
+  assert("234" == index.path(node2, node4) &&
+         "The aggregate must follow the path from the ancestor.");
+
+  return 0;
+}();
+
+} // namespace
@@ -0,0 +1,142 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_index.hpp"
+// fcarouge::interval_index
+
+#include <algorithm>
+// std::binary_search std::is_sorted std::lower_bound std::sort
+
+#include <cassert>
+// assert
+
+#include <set>
+// std::set
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @brief Checks the ancestry by walking the parent links.
+bool walk_is_ancestor(fcarouge::tree<int>::const_iterator ancestor,
+                      fcarouge::tree<int>::const_iterator descendant)
+{
+  for (auto *node = descendant.node; node; node = node->parent) {
+    if (node == ancestor.node) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+//! @test Verify the ancestry and ordering of every pair of nodes of a complex
+//! container.
+//!
+//! @dot
+//! digraph {
+//!   node [shape=circle fontsize="10"];
+//!   0 -> {1, 2, 3}
+//!   1 -> {11, 12}
+//!   12 -> {121}
+//!   3 -> {31}
+//! }
+//! @enddot
+[[maybe_unused]] auto complex = []() {
+  fcarouge::tree_int etretat_ash(0);
+  const auto node1 = etretat_ash.push(etretat_ash.begin(), 1);
+  etretat_ash.push(node1, 11);
+  etretat_ash.push(etretat_ash.push(node1, 12), 121);
+  etretat_ash.push(etretat_ash.begin(), 2);
+  etretat_ash.push(etretat_ash.push(etretat_ash.begin(), 3), 31);
+
+  fcarouge::interval_index index{ etretat_ash };
+  auto lhs_order = 0;
+  for (auto lhs = etretat_ash.cbegin(); lhs != etretat_ash.cend();
+       ++lhs, ++lhs_order) {
+    auto rhs_order = 0;
+    for (auto rhs = etretat_ash.cbegin(); rhs != etretat_ash.cend();
+         ++rhs, ++rhs_order) {
+      assert(walk_is_ancestor(lhs, rhs) == index.is_ancestor(lhs, rhs) &&
+             "The ancestry must meet requirements.");
+      assert((lhs_order < rhs_order) == index.precedes(lhs, rhs) &&
+             "The ordering must follow the pre-order traversal.");
+    }
+  }
+
+  return 0;
+}();
+
+//! @test Verify the ordering sorts and searches iterators.
+[[maybe_unused]] auto sort = []() {
+  fcarouge::tree_int etretat_ash(0);
+  const auto node1 = etretat_ash.push(etretat_ash.begin(), 1);
+  const auto node11 = etretat_ash.push(node1, 11);
+  const auto node2 = etretat_ash.push(etretat_ash.begin(), 2);
+  const auto node21 = etretat_ash.push(node2, 21);
+
+  fcarouge::interval_index index{ etretat_ash };
+  const auto precedes = [&index](auto lhs, auto rhs) {
+    return index.precedes(lhs, rhs);
+  };
+
+  std::vector<fcarouge::tree<int>::iterator> positions{ node21, node1, node2,
+                                                        node11 };
+  std::sort(positions.begin(), positions.end(), precedes);
+  const std::vector<fcarouge::tree<int>::iterator> expected_positions{
+    node1, node11, node2, node21
+  };
+  assert(expected_positions == positions &&
+         "The sorted iterators must follow the pre-order traversal.");
+  assert(node2 == *std::lower_bound(positions.begin(), positions.end(), node2,
+                                    precedes) &&
+         "The binary search must find the iterator.");
+
+  std::set<fcarouge::tree<int>::iterator, decltype(precedes)> sorted{
+    precedes
+  };
+  sorted.insert(node21);
+  sorted.insert(node1);
+  const auto node12 = etretat_ash.push(node1, 12);
+  sorted.insert(node12);
+  sorted.insert(etretat_ash.begin());
+  assert(std::is_sorted(sorted.begin(), sorted.end(), precedes) &&
+         "The sorted container must remain sorted after a relabeling.");
+  assert(etretat_ash.begin() == *sorted.begin() &&
+         "The root must be the first element in pre-order.");
+  assert(std::binary_search(sorted.begin(), sorted.end(), node12, precedes) &&
+         "The binary search must find the iterator after a relabeling.");
+
+  return 0;
+}();
+
+} // namespace
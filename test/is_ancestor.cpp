@@ -0,0 +1,115 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree.hpp"
+// fcarouge::node_policy fcarouge::tree
+
+#include "fcarouge/tree_algorithm.hpp"
+// fcarouge::is_ancestor
+
+#include <cassert>
+// assert
+
+#include <memory>
+// std::allocator
+
+namespace
+{
+//! @brief Checks the ancestry by walking the parent links.
+template <typename Iterator>
+bool walk_is_ancestor(Iterator ancestor, Iterator descendant)
+{
+  for (auto *node = descendant.node; node; node = node->parent) {
+    if (node == ancestor.node) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+//! @brief Grows a container by insertions at every kind of position.
+template <typename Tree> Tree grow()
+{
+  Tree honfleur_maple(0);
+  auto node = honfleur_maple.begin();
+  for (int value = 1; value < 40; ++value) {
+    switch (value % 5) {
+    case 0:
+      node = honfleur_maple.push(node, value);
+      break;
+    case 1:
+      honfleur_maple.emplace(node, value);
+      break;
+    case 2:
+      honfleur_maple.push(honfleur_maple.begin(), value);
+      break;
+    case 3:
+      honfleur_maple.insert(honfleur_maple.end(), value);
+      break;
+    default:
+      honfleur_maple.push_front(value);
+      break;
+    }
+  }
+
+  return honfleur_maple;
+}
+
+//! @test Verify the ancestry of every pair of elements of a container grown
+//! by insertions at every kind of position.
+[[maybe_unused]] auto complex = []() {
+  const auto honfleur_maple = grow<fcarouge::tree<int>>();
+  for (auto lhs = honfleur_maple.cbegin(); lhs != honfleur_maple.cend();
+       ++lhs) {
+    for (auto rhs = honfleur_maple.cbegin(); rhs != honfleur_maple.cend();
+         ++rhs) {
+      assert(walk_is_ancestor(lhs, rhs) == is_ancestor(lhs, rhs) &&
+             "The ancestry must meet requirements.");
+    }
+  }
+
+  return 0;
+}();
+
+//! @test Verify the ancestry of every pair of elements of a container
+//! maintaining the order labels of its nodes.
+[[maybe_unused]] auto labeled = []() {
+  const auto honfleur_ash = grow<fcarouge::tree<
+      int, std::allocator<int>, fcarouge::node_policy<false, true>>>();
+  for (auto lhs = honfleur_ash.cbegin(); lhs != honfleur_ash.cend(); ++lhs) {
+    for (auto rhs = honfleur_ash.cbegin(); rhs != honfleur_ash.cend(); ++rhs) {
+      assert(walk_is_ancestor(lhs, rhs) == is_ancestor(lhs, rhs) &&
+             "The ancestry from the labels must meet requirements.");
+    }
+  }
+
+  return 0;
+}();
+
+} // namespace
@@ -0,0 +1,137 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_view.hpp"
+// fcarouge::leaves
+
+#include <algorithm>
+// std::ranges::equal
+
+#include <cassert>
+// assert
+
+#include <memory_resource>
+// std::pmr::monotonic_buffer_resource std::pmr::polymorphic_allocator
+
+#include <ranges>
+// std::ranges::forward_range std::ranges::view
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @test Verify the view meet the forward range and view concepts.
+[[maybe_unused]] constexpr auto concepts = []() {
+  using view = decltype(fcarouge::leaves(fcarouge::tree<int>::iterator{}));
+  static_assert(std::ranges::view<view>,
+                "The container's leaves view must meet the view concept.");
+  static_assert(std::ranges::forward_range<view>,
+                "The container's leaves view must meet the forward range "
+                "concept.");
+
+  return 0;
+}();
+
+//! @test Verify the leaves of the subtrees.
+[[maybe_unused]] auto subtree = []() {
+  fcarouge::tree_int avranches_linden(0);
+  const auto node1 = avranches_linden.push(avranches_linden.begin(), 1);
+  avranches_linden.push(avranches_linden.push(node1, 11), 111);
+  const auto node12 = avranches_linden.push(node1, 12);
+  avranches_linden.push(node12, 121);
+  avranches_linden.push(node12, 122);
+  avranches_linden.push(avranches_linden.begin(), 2);
+  const auto node3 = avranches_linden.push(avranches_linden.begin(), 3);
+  avranches_linden.push(node3, 31);
+
+  // 0
+  // ├── 1
+  // │   ├── 11
+  // │   │   └── 111
+  // │   └── 12
+  // │       ├── 121
+  // │       └── 122
+  // ├── 2
+  // └── 3
+  //     └── 31
+
+  assert(std::ranges::equal(fcarouge::leaves(avranches_linden.begin()),
+                            std::vector{ 111, 121, 122, 2, 31 }) &&
+         "The leaves of the container must meet requirements.");
+  assert(std::ranges::equal(fcarouge::leaves(node1),
+                            std::vector{ 111, 121, 122 }) &&
+         "The leaves must be bounded by the subtree.");
+  assert(std::ranges::equal(fcarouge::leaves(node12),
+                            std::vector{ 121, 122 }) &&
+         "The leaves of the last child must be bounded by the subtree.");
+  assert(std::ranges::equal(fcarouge::leaves(node3), std::vector{ 31 }) &&
+         "The leaves of the last subtree must end with the container.");
+  assert(std::ranges::equal(fcarouge::leaves(avranches_linden.cbegin()),
+                            std::vector{ 111, 121, 122, 2, 31 }) &&
+         "The leaves of a constant iterator must meet requirements.");
+
+  return 0;
+}();
+
+//! @test Verify a leaf is its own sole leaf.
+[[maybe_unused]] auto leaf = []() {
+  fcarouge::tree_int avranches_linden(0);
+  const auto node1 = avranches_linden.push(avranches_linden.begin(), 1);
+  avranches_linden.push(avranches_linden.begin(), 2);
+
+  assert(std::ranges::equal(fcarouge::leaves(node1), std::vector{ 1 }) &&
+         "A leaf must be its own sole leaf.");
+
+  return 0;
+}();
+
+//! @test Verify the leaves of a container with a non-default allocator.
+[[maybe_unused]] auto allocator = []() {
+  std::pmr::monotonic_buffer_resource resource;
+  fcarouge::tree<int, std::pmr::polymorphic_allocator<int>> avranches_linden{
+    std::pmr::polymorphic_allocator<int>{ &resource }
+  };
+  avranches_linden.emplace(avranches_linden.end(), 0);
+  avranches_linden.push(avranches_linden.push(avranches_linden.begin(), 1), 11);
+  avranches_linden.push(avranches_linden.begin(), 2);
+
+  assert(std::ranges::equal(fcarouge::leaves(avranches_linden.begin()),
+                            std::vector{ 11, 2 }) &&
+         "The leaves must be viewed from left to right.");
+  assert(std::ranges::equal(fcarouge::leaves(avranches_linden.cbegin()),
+                            std::vector{ 11, 2 }) &&
+         "The leaves of a constant iterator must meet requirements.");
+
+  return 0;
+}();
+
+} // namespace
@@ -0,0 +1,130 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_view.hpp"
+// fcarouge::level_view
+
+#include <algorithm>
+// std::ranges::equal
+
+#include <cassert>
+// assert
+
+#include <ranges>
+// std::ranges::empty std::ranges::forward_range std::ranges::view
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @test Verify the view meet the forward range and view concepts.
+[[maybe_unused]] constexpr auto concepts = []() {
+  using view = fcarouge::level_view<fcarouge::tree<int>::iterator>;
+  static_assert(std::ranges::view<view>,
+                "The container's level view must meet the view concept.");
+  static_assert(std::ranges::forward_range<view>,
+                "The container's level view must meet the forward range "
+                "concept.");
+
+  return 0;
+}();
+
+//! @test Verify the elements of every level of an uneven container.
+[[maybe_unused]] auto levels = []() {
+  fcarouge::tree_int carentan_poplar(0);
+  const auto node1 = carentan_poplar.push(carentan_poplar.begin(), 1);
+  carentan_poplar.push(carentan_poplar.push(node1, 11), 111);
+  carentan_poplar.push(carentan_poplar.begin(), 2);
+  carentan_poplar.push(carentan_poplar.begin(), 3);
+  const auto it = carentan_poplar.push(carentan_poplar.begin(), 5);
+  carentan_poplar.push(it, 51);
+  carentan_poplar.emplace(
+      carentan_poplar.push(carentan_poplar.push(it, 52), 522), 521);
+
+  // 0
+  // ├── 1
+  // │   └── 11
+  // │       └── 111
+  // ├── 2
+  // ├── 3
+  // └── 5
+  //     ├── 51
+  //     └── 52
+  //         ├── 521
+  //         └── 522
+
+  const std::vector<std::vector<int>> expected_levels{
+    { 0 }, { 1, 2, 3, 5 }, { 11, 51, 52 }, { 111, 521, 522 }
+  };
+  for (int depth = 0; depth < 4; ++depth) {
+    const fcarouge::level_view level{ carentan_poplar, depth };
+    assert(std::ranges::equal(level, expected_levels[depth]) &&
+           "The level must meet requirements.");
+  }
+  assert(std::ranges::empty(fcarouge::level_view{ carentan_poplar, 4 }) &&
+         "The level below the deepest element must be empty.");
+  assert(std::ranges::empty(fcarouge::level_view{ carentan_poplar, -1 }) &&
+         "The level above the root must be empty.");
+
+  return 0;
+}();
+
+//! @test Verify the view of a constant container is modifiable through the
+//! container only.
+[[maybe_unused]] auto constant = []() {
+  fcarouge::tree_int carentan_poplar(0);
+  carentan_poplar.push(carentan_poplar.begin(), 1);
+  carentan_poplar.push(carentan_poplar.begin(), 2);
+
+  for (auto &value : fcarouge::level_view{ carentan_poplar, 1 }) {
+    value *= 10;
+  }
+  const auto &const_carentan_poplar = carentan_poplar;
+  const std::vector<int> expected_level{ 10, 20 };
+  assert(std::ranges::equal(fcarouge::level_view{ const_carentan_poplar, 1 },
+                            expected_level) &&
+         "The constant level must meet requirements.");
+
+  return 0;
+}();
+
+//! @test Verify the view of an empty container.
+[[maybe_unused]] auto empty = []() {
+  fcarouge::tree_int carentan_poplar;
+
+  assert(std::ranges::empty(fcarouge::level_view{ carentan_poplar, 0 }) &&
+         "The view of an empty container must be empty.");
+
+  return 0;
+}();
+
+} // namespace
@@ -0,0 +1,134 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_index.hpp"
+// fcarouge::lowest_common_ancestor_index
+
+#include <cassert>
+// assert
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @brief Finds the lowest common ancestor by walking the parent links.
+auto walk_lowest_common_ancestor(fcarouge::tree<int>::const_iterator lhs,
+                                 fcarouge::tree<int>::const_iterator rhs)
+{
+  for (auto *ancestor = lhs.node; ancestor; ancestor = ancestor->parent) {
+    for (auto *other = rhs.node; other; other = other->parent) {
+      if (ancestor == other) {
+        return fcarouge::tree<int>::const_iterator{ ancestor };
+      }
+    }
+  }
+
+  return fcarouge::tree<int>::const_iterator{};
+}
+
+//! @test Verify the lowest common ancestor of a sole root.
+[[maybe_unused]] auto root = []() {
+  const fcarouge::tree_int jumieges_elm(42);
+  fcarouge::lowest_common_ancestor_index index{ jumieges_elm };
+
+  assert(jumieges_elm.begin() ==
+             index.lowest_common_ancestor(jumieges_elm.begin(),
+                                          jumieges_elm.begin()) &&
+         "The lowest common ancestor of the root is the root.");
+
+  return 0;
+}();
+
+//! @test Verify the lowest common ancestors of every pair of nodes of a
+//! complex container.
+//!
+//! @dot
+//! digraph {
+//!   node [shape=circle fontsize="10"];
+//!   0 -> {1, 2, 3}
+//!   1 -> {11}
+//!   11 -> {111, 112}
+//!   3 -> {31, 32}
+//!   32 -> {321}
+//! }
+//! @enddot
+[[maybe_unused]] auto complex = []() {
+  fcarouge::tree_int jumieges_elm(0);
+  const auto node11 =
+      jumieges_elm.push(jumieges_elm.push(jumieges_elm.begin(), 1), 11);
+  jumieges_elm.push(node11, 111);
+  jumieges_elm.push(node11, 112);
+  jumieges_elm.push(jumieges_elm.begin(), 2);
+  const auto node3 = jumieges_elm.push(jumieges_elm.begin(), 3);
+  jumieges_elm.push(node3, 31);
+  jumieges_elm.push(jumieges_elm.push(node3, 32), 321);
+
+  fcarouge::lowest_common_ancestor_index index{ jumieges_elm };
+  for (auto lhs = jumieges_elm.cbegin(); lhs != jumieges_elm.cend(); ++lhs) {
+    for (auto rhs = jumieges_elm.cbegin(); rhs != jumieges_elm.cend(); ++rhs) {
+      assert(walk_lowest_common_ancestor(lhs, rhs) ==
+                 index.lowest_common_ancestor(lhs, rhs) &&
+             "The lowest common ancestor must meet requirements.");
+    }
+  }
+
+  return 0;
+}();
+
+//! @test Verify the index is rebuilt after modifications of the container.
+[[maybe_unused]] auto rebuild = []() {
+  fcarouge::tree_int jumieges_elm(0);
+  const auto node1 = jumieges_elm.push(jumieges_elm.begin(), 1);
+  const auto node2 = jumieges_elm.push(jumieges_elm.begin(), 2);
+
+  fcarouge::lowest_common_ancestor_index index{ jumieges_elm };
+  assert(jumieges_elm.begin() == index.lowest_common_ancestor(node1, node2) &&
+         "The lowest common ancestor of siblings is their parent.");
+
+  const auto node12 = jumieges_elm.push(node1, 12);
+  const auto node11 = jumieges_elm.emplace(node12, 11);
+  assert(node1 == index.lowest_common_ancestor(node11, node12) &&
+         "The index must be rebuilt after insertions.");
+
+  jumieges_elm.push_front(-1);
+  assert(jumieges_elm.begin() ==
+             index.lowest_common_ancestor(jumieges_elm.begin(), node2) &&
+         "The index must be rebuilt after a new root.");
+
+  jumieges_elm.erase(node12);
+  assert(node1 == index.lowest_common_ancestor(node11, node1) &&
+         "The index must be rebuilt after erasures.");
+
+  return 0;
+}();
+
+} // namespace
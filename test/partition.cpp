@@ -0,0 +1,107 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree_algorithm.hpp"
+// fcarouge::partition
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "bushy.hpp"
+// fcarouge::bushy
+
+#include <cassert>
+// assert
+
+#include <cstddef>
+// std::size_t
+
+#include <iterator>
+// std::ranges::distance
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @test Verify the chunks cover the container in pre-order with balanced
+//! sizes.
+[[maybe_unused]] auto balanced = []() {
+  fcarouge::tree<int> jumieges_beech{ fcarouge::bushy(1000) };
+
+  for (std::size_t count : { 1, 2, 3, 7, 64, 999, 1000 }) {
+    const auto chunks{ fcarouge::partition(jumieges_beech, count) };
+    assert(chunks.size() == count && "The partition has the requested count.");
+
+    std::vector<int> values;
+    for (const auto &chunk : chunks) {
+      const auto length{ std::ranges::distance(chunk) };
+      assert((length == 1000 / static_cast<int>(count) ||
+              length == 1000 / static_cast<int>(count) + 1) &&
+             "The chunk sizes differ by at most one.");
+      for (int &value : chunk) {
+        values.push_back(value);
+      }
+    }
+
+    assert(std::vector<int>(jumieges_beech.begin(), jumieges_beech.end()) ==
+               values &&
+           "The chunks cover the container in pre-order.");
+  }
+
+  return 0;
+}();
+
+//! @test Verify the trailing chunks are empty when there are more chunks than
+//! elements.
+[[maybe_unused]] auto surplus = []() {
+  const fcarouge::tree<int> jumieges_beech{ fcarouge::bushy(3) };
+
+  const auto chunks{ fcarouge::partition(jumieges_beech, 5) };
+  assert(chunks.size() == 5 && "The partition has the requested count.");
+  assert(chunks[0].front() == 0 && chunks[1].front() == 1 &&
+         chunks[2].front() == 2 && "The elements are in their own chunk.");
+  assert(chunks[3].empty() && chunks[4].empty() &&
+         "The trailing chunks are empty.");
+  assert(chunks[2].end() == jumieges_beech.end() &&
+         "The last chunk reaches the end of the container.");
+
+  return 0;
+}();
+
+//! @test Verify an empty container partitions into empty chunks.
+[[maybe_unused]] auto empty = []() {
+  const fcarouge::tree<int> jumieges_beech;
+
+  for (const auto &chunk : fcarouge::partition(jumieges_beech, 4)) {
+    assert(chunk.empty() && "The chunk of an empty container is empty.");
+  }
+
+  return 0;
+}();
+} // namespace
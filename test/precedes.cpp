@@ -0,0 +1,168 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree.hpp"
+// fcarouge::node_policy fcarouge::tree
+
+#include "fcarouge/tree_algorithm.hpp"
+// fcarouge::precedes
+
+#include <cassert>
+// assert
+
+#include <cstddef>
+// std::size_t
+
+#include <memory>
+// std::allocator
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @brief The container type maintaining the order labels of its nodes.
+using labeled_tree = fcarouge::tree<int, std::allocator<int>,
+                                    fcarouge::node_policy<false, true>>;
+
+//! @brief Checks every consecutive pair of the pre-order traversal is ordered.
+template <typename Tree> bool ordered(const Tree &container)
+{
+  std::vector<typename Tree::const_iterator> positions;
+  for (auto position = container.cbegin(); position != container.cend();
+       ++position) {
+    positions.push_back(position);
+  }
+  for (std::size_t index = 1; index < positions.size(); ++index) {
+    if (!precedes(positions[index - 1], positions[index]) ||
+        precedes(positions[index], positions[index - 1])) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+//! @test Verify an element does not precede itself.
+[[maybe_unused]] auto irreflexive = []() {
+  fcarouge::tree_int rouen_cedar(42);
+  assert(!precedes(rouen_cedar.begin(), rouen_cedar.begin()) &&
+         "An element must not precede itself.");
+
+  labeled_tree rouen_yew(42);
+  assert(!precedes(rouen_yew.begin(), rouen_yew.begin()) &&
+         "A labeled element must not precede itself.");
+
+  return 0;
+}();
+
+//! @test Verify the ordering of the elements inserted repeatedly at the same
+//! positions, exhausting the gaps between the labels.
+[[maybe_unused]] auto crowded = []() {
+  labeled_tree rouen_cedar(0);
+  const auto node1 = rouen_cedar.push(rouen_cedar.begin(), 1);
+  const auto node2 = rouen_cedar.push(rouen_cedar.begin(), 2);
+  for (int value = 0; value < 1000; ++value) {
+    rouen_cedar.push(rouen_cedar.begin(), value);
+    rouen_cedar.emplace(node2, value);
+    rouen_cedar.push(node1, value);
+    rouen_cedar.push_front(value);
+    rouen_cedar.emplace(rouen_cedar.begin(), value);
+  }
+
+  assert(ordered(rouen_cedar) &&
+         "The ordering must follow the pre-order traversal.");
+
+  const labeled_tree copy_cedar(rouen_cedar);
+  assert(ordered(copy_cedar) &&
+         "The ordering of a copy must follow the pre-order traversal.");
+
+  return 0;
+}();
+
+//! @test Verify the ordering of the elements inserted at scattered positions.
+[[maybe_unused]] auto scattered = []() {
+  labeled_tree rouen_cedar(0);
+  std::vector<labeled_tree::iterator> positions{ rouen_cedar.begin() };
+  unsigned int random = 42;
+  for (int value = 1; value < 3000; ++value) {
+    random = random * 1103515245u + 12345u;
+    const auto position = positions[(random >> 8) % positions.size()];
+    switch ((random >> 4) % 4) {
+    case 0:
+      positions.push_back(rouen_cedar.push(position, value));
+      break;
+    case 1:
+      positions.push_back(rouen_cedar.emplace(position, value));
+      break;
+    case 2:
+      positions.push_back(rouen_cedar.insert(rouen_cedar.end(), value));
+      break;
+    default:
+      rouen_cedar.push_front(value);
+      positions.push_back(rouen_cedar.begin());
+      break;
+    }
+  }
+
+  assert(ordered(rouen_cedar) &&
+         "The ordering must follow the pre-order traversal.");
+
+  return 0;
+}();
+
+//! @test Verify the ordering of the elements of a container without order
+//! labels.
+[[maybe_unused]] auto unlabeled = []() {
+  fcarouge::tree_int rouen_beech(0);
+  std::vector<fcarouge::tree<int>::iterator> positions{ rouen_beech.begin() };
+  unsigned int random = 42;
+  for (int value = 1; value < 300; ++value) {
+    random = random * 1103515245u + 12345u;
+    const auto position = positions[(random >> 8) % positions.size()];
+    switch ((random >> 4) % 3) {
+    case 0:
+      positions.push_back(rouen_beech.push(position, value));
+      break;
+    case 1:
+      positions.push_back(rouen_beech.emplace(position, value));
+      break;
+    default:
+      rouen_beech.push_front(value);
+      positions.push_back(rouen_beech.begin());
+      break;
+    }
+  }
+
+  assert(ordered(rouen_beech) &&
+         "The ordering must follow the pre-order traversal.");
+
+  return 0;
+}();
+
+} // namespace
@@ -0,0 +1,148 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree_algorithm.hpp"
+// fcarouge::propagate_down
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_execution.hpp"
+// fcarouge::par fcarouge::parallel_policy fcarouge::seq
+
+#include "bushy.hpp"
+// fcarouge::bushy
+
+#include <cassert>
+// assert
+
+#include <cstddef>
+// std::size_t
+
+#include <stdexcept>
+// std::runtime_error
+
+#include <string>
+// std::string
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @test Verify the sequenced propagation accumulates the ancestors.
+[[maybe_unused]] auto sequenced = []() {
+  fcarouge::tree<int> hambye_yew{ 1 };
+  auto position{ hambye_yew.push(hambye_yew.begin(), 2) };
+  hambye_yew.push(position, 4);
+  hambye_yew.push(hambye_yew.begin(), 8);
+
+  fcarouge::propagate_down(fcarouge::seq, hambye_yew,
+                           [](int parent, int &child) { child += parent; });
+
+  assert((std::vector<int>(hambye_yew.begin(), hambye_yew.end()) ==
+          std::vector<int>{ 1, 3, 7, 9 }) &&
+         "The elements accumulate their ancestors.");
+
+  return 0;
+}();
+
+//! @test Verify the parallel propagation matches the sequenced propagation.
+[[maybe_unused]] auto parallel = []() {
+  for (const std::size_t concurrency : { 1, 2, 4, 7 }) {
+    fcarouge::tree<int> hambye_yew{ fcarouge::bushy(20000) };
+    fcarouge::tree<int> sequenced_yew{ hambye_yew };
+
+    const auto accumulate = [](int parent, int &child) {
+      child = (child + parent) % 1000003;
+    };
+    fcarouge::propagate_down(fcarouge::parallel_policy{ concurrency },
+                             hambye_yew, accumulate);
+    fcarouge::propagate_down(fcarouge::seq, sequenced_yew, accumulate);
+
+    assert(hambye_yew == sequenced_yew &&
+           "The parallel propagation matches the sequenced propagation.");
+  }
+
+  return 0;
+}();
+
+//! @test Verify the parallel propagation of a chain.
+[[maybe_unused]] auto chain = []() {
+  fcarouge::tree<int> hambye_yew{ 0 };
+  auto position{ hambye_yew.begin() };
+  for (int i = 0; i < 100; ++i) {
+    position = hambye_yew.push(position, 0);
+  }
+
+  fcarouge::propagate_down(fcarouge::par, hambye_yew,
+                           [](int parent, int &child) { child = parent + 1; });
+
+  int depth{ 0 };
+  for (const int value : hambye_yew) {
+    assert(value == depth++ && "The elements are their depth.");
+  }
+
+  return 0;
+}();
+
+//! @test Verify the parallel propagation of an empty container and of a
+//! single root.
+[[maybe_unused]] auto trivial = []() {
+  fcarouge::tree<int> hambye_yew;
+  fcarouge::propagate_down(fcarouge::par, hambye_yew,
+                           [](int, int &) { assert(false && "Not called."); });
+
+  hambye_yew.emplace(hambye_yew.end(), 42);
+  fcarouge::propagate_down(fcarouge::par, hambye_yew,
+                           [](int, int &) { assert(false && "Not called."); });
+  assert(*hambye_yew.begin() == 42 && "The root is unchanged.");
+
+  return 0;
+}();
+
+//! @test Verify the first exception of the function is rethrown.
+[[maybe_unused]] auto exception = []() {
+  fcarouge::tree<int> hambye_yew{ fcarouge::bushy(5000) };
+
+  bool thrown{ false };
+  try {
+    fcarouge::propagate_down(fcarouge::parallel_policy{ 4 }, hambye_yew,
+                             [](int, int &child) {
+                               if (child == 4321) {
+                                 throw std::runtime_error{ "4321" };
+                               }
+                             });
+  } catch (const std::runtime_error &error) {
+    thrown = error.what() == std::string{ "4321" };
+  }
+  assert(thrown && "The exception is rethrown.");
+
+  return 0;
+}();
+} // namespace
@@ -0,0 +1,108 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree_algorithm.hpp"
+// fcarouge::reduce
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_execution.hpp"
+// fcarouge::par fcarouge::parallel_policy fcarouge::seq
+
+#include "bushy.hpp"
+// fcarouge::bushy
+
+#include <cassert>
+// assert
+
+#include <functional>
+// std::multiplies
+
+#include <numeric>
+// std::accumulate
+
+#include <string>
+// std::string
+
+namespace
+{
+//! @test Verify the sum of the elements.
+[[maybe_unused]] auto sum = []() {
+  const auto eawy_beech{ fcarouge::bushy<fcarouge::tree<long>>(10000, 1) };
+  const long expected{ std::accumulate(eawy_beech.begin(), eawy_beech.end(),
+                                       10L) };
+
+  assert(expected == fcarouge::reduce(fcarouge::seq, eawy_beech, 10L) &&
+         "The sequenced reduction must sum the elements and initial value.");
+  assert(expected == fcarouge::reduce(fcarouge::par, eawy_beech, 10L) &&
+         "The parallel reduction must sum the elements and initial value.");
+  assert(expected == fcarouge::reduce(fcarouge::parallel_policy{ 3 },
+                                      eawy_beech, 10L) &&
+         "The parallel reduction must sum the elements and initial value.");
+
+  return 0;
+}();
+
+//! @test Verify the reduction by a user-provided operation.
+[[maybe_unused]] auto operation = []() {
+  const auto eawy_beech{ fcarouge::bushy<fcarouge::tree<long>>(20, 1) };
+
+  assert(
+      2432902008176640000L == fcarouge::reduce(fcarouge::parallel_policy{ 4 },
+                                               eawy_beech, 1L,
+                                               std::multiplies<>{}) &&
+      "The parallel reduction must use the reduction operation.");
+
+  return 0;
+}();
+
+//! @test Verify the sequenced reduction folds in pre-order.
+[[maybe_unused]] auto order = []() {
+  fcarouge::tree<std::string> lyons_beech("a");
+  lyons_beech.push(lyons_beech.push(lyons_beech.begin(), "b"), "c");
+  lyons_beech.push(lyons_beech.begin(), "d");
+
+  assert("_abcd" == fcarouge::reduce(fcarouge::seq, lyons_beech,
+                                     std::string{ "_" }) &&
+         "The sequenced reduction must fold the elements in pre-order.");
+
+  return 0;
+}();
+
+//! @test Verify the reduction of an empty container is the initial value.
+[[maybe_unused]] auto empty = []() {
+  const fcarouge::tree<long> eawy_beech;
+
+  assert(42 == fcarouge::reduce(fcarouge::par, eawy_beech, 42L) &&
+         "The reduction of an empty container must be the initial value.");
+
+  return 0;
+}();
+
+} // namespace
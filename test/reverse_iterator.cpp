@@ -0,0 +1,143 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree fcarouge::tree::reverse_iterator
+// fcarouge::tree::const_reverse_iterator
+
+#include <algorithm>
+// std::equal
+
+#include <cassert>
+// assert
+
+#include <iterator>
+// std::bidirectional_iterator
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @test Verify the reverse iterators meet the bidirectional iterator concept.
+[[maybe_unused]] constexpr auto bidirectional_iterator = []() {
+  static_assert(
+      std::bidirectional_iterator<fcarouge::tree<int>::reverse_iterator>,
+      "The container's reverse iterator must meet the bidirectional iterator "
+      "concept.");
+  static_assert(
+      std::bidirectional_iterator<fcarouge::tree<int>::const_reverse_iterator>,
+      "The container's constant reverse iterator must meet the bidirectional "
+      "iterator concept.");
+
+  return 0;
+}();
+
+//! @test Verify the reverse iteration of an empty container.
+[[maybe_unused]] auto empty = []() {
+  fcarouge::tree_int bayeux_birch;
+  const auto &const_bayeux_birch = bayeux_birch;
+
+  assert(bayeux_birch.rbegin() == bayeux_birch.rend() &&
+         "The reverse iterators of an empty container must be equal.");
+  assert(const_bayeux_birch.rbegin() == const_bayeux_birch.rend() &&
+         "The reverse iterators of an empty container must be equal.");
+  assert(bayeux_birch.crbegin() == bayeux_birch.crend() &&
+         "The reverse iterators of an empty container must be equal.");
+
+  return 0;
+}();
+
+//! @test Verify the order of the reverse depth first pre-order iteration.
+[[maybe_unused]] auto iterate = []() {
+  fcarouge::tree_int gouy_yew(0);
+  gouy_yew.push(gouy_yew.push(gouy_yew.push(gouy_yew.begin(), 1), 11), 111);
+  gouy_yew.push(gouy_yew.begin(), 2);
+  gouy_yew.push(gouy_yew.begin(), 3);
+  gouy_yew.push(gouy_yew.begin(), 4);
+  const auto it = gouy_yew.push(gouy_yew.begin(), 5);
+  gouy_yew.emplace(gouy_yew.push(gouy_yew.push(it, 51), 512), 511);
+  gouy_yew.emplace(gouy_yew.push(gouy_yew.push(it, 52), 522), 521);
+  gouy_yew.emplace(gouy_yew.push(gouy_yew.push(it, 53), 532), 531);
+  const auto &const_gouy_yew = gouy_yew;
+
+  // 0
+  // ├── 1
+  // │   └── 11
+  // │       └── 111
+  // ├── 2
+  // ├── 3
+  // ├── 4
+  // └── 5
+  //     ├── 51
+  //     │   ├── 511
+  //     │   └── 512
+  //     ├── 52
+  //     │   ├── 521
+  //     │   └── 522
+  //     └── 53
+  //         ├── 531
+  //         └── 532
+
+  const std::vector<int> expected_content{ 532, 531, 53, 522, 521, 52,
+                                           512, 511, 51, 5,   4,   3,
+                                           2,   111, 11, 1,   0 };
+
+  assert(std::equal(gouy_yew.rbegin(), gouy_yew.rend(),
+                    expected_content.begin(), expected_content.end()) &&
+         "The reverse traversal must be the reversed pre-order traversal.");
+  assert(std::equal(const_gouy_yew.rbegin(), const_gouy_yew.rend(),
+                    expected_content.begin(), expected_content.end()) &&
+         "The reverse traversal must be the reversed pre-order traversal.");
+  assert(std::equal(gouy_yew.crbegin(), gouy_yew.crend(),
+                    expected_content.begin(), expected_content.end()) &&
+         "The reverse traversal must be the reversed pre-order traversal.");
+
+  return 0;
+}();
+
+//! @test Verify the reverse iterator position converts back to its forward
+//! pre-order position.
+[[maybe_unused]] auto base = []() {
+  fcarouge::tree_int mortain_rowan(0);
+  mortain_rowan.push(mortain_rowan.push(mortain_rowan.begin(), 1), 11);
+  mortain_rowan.push(mortain_rowan.begin(), 2);
+
+  auto position = mortain_rowan.rbegin();
+  ++position;
+  assert(*position == 11 && "The reverse iterator must visit the previous "
+                            "element in pre-order.");
+  assert(*std::prev(position.base()) == 11 &&
+         "The base iterator must follow the reverse position.");
+  assert(*position.base() == 2 &&
+         "The base iterator must be the next element in pre-order.");
+
+  return 0;
+}();
+
+} // namespace
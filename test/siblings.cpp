@@ -0,0 +1,104 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_view.hpp"
+// fcarouge::siblings
+
+#include <algorithm>
+// std::ranges::equal
+
+#include <cassert>
+// assert
+
+#include <memory_resource>
+// std::pmr::monotonic_buffer_resource std::pmr::polymorphic_allocator
+
+#include <ranges>
+// std::ranges::forward_range std::ranges::view
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @test Verify the view meet the forward range and view concepts.
+[[maybe_unused]] constexpr auto concepts = []() {
+  using view = decltype(fcarouge::siblings(fcarouge::tree<int>::iterator{}));
+  static_assert(std::ranges::view<view>,
+                "The container's siblings view must meet the view concept.");
+  static_assert(std::ranges::forward_range<view>,
+                "The container's siblings view must meet the forward range "
+                "concept.");
+
+  return 0;
+}();
+
+//! @test Verify the siblings of the elements.
+[[maybe_unused]] auto family = []() {
+  fcarouge::tree_int mortain_alder(0);
+  mortain_alder.push(mortain_alder.begin(), 1);
+  const auto node2 = mortain_alder.push(mortain_alder.begin(), 2);
+  mortain_alder.push(mortain_alder.begin(), 3);
+  const auto node21 = mortain_alder.push(node2, 21);
+
+  assert(std::ranges::equal(fcarouge::siblings(node2),
+                            std::vector{ 1, 2, 3 }) &&
+         "The siblings must include the element, from the first child.");
+  assert(std::ranges::equal(fcarouge::siblings(node21), std::vector{ 21 }) &&
+         "An only child is its sole sibling.");
+  assert(std::ranges::equal(fcarouge::siblings(mortain_alder.cbegin()),
+                            std::vector{ 0 }) &&
+         "The root is its sole sibling.");
+
+  return 0;
+}();
+
+//! @test Verify the siblings of an element of a container with a
+//! non-default allocator.
+[[maybe_unused]] auto allocator = []() {
+  std::pmr::monotonic_buffer_resource resource;
+  fcarouge::tree<int, std::pmr::polymorphic_allocator<int>> mortain_alder{
+    std::pmr::polymorphic_allocator<int>{ &resource }
+  };
+  mortain_alder.emplace(mortain_alder.end(), 0);
+  mortain_alder.push(mortain_alder.begin(), 1);
+  const auto node2 = mortain_alder.push(mortain_alder.begin(), 2);
+
+  assert(std::ranges::equal(fcarouge::siblings(node2), std::vector{ 1, 2 }) &&
+         "The siblings must include the element.");
+  assert(std::ranges::equal(fcarouge::siblings(mortain_alder.cbegin()),
+                            std::vector{ 0 }) &&
+         "The root is its sole sibling.");
+
+  return 0;
+}();
+
+} // namespace
@@ -0,0 +1,178 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_view.hpp"
+// fcarouge::subtree
+
+#include <algorithm>
+// std::ranges::equal
+
+#include <cassert>
+// assert
+
+#include <memory_resource>
+// std::pmr::monotonic_buffer_resource std::pmr::polymorphic_allocator
+
+#include <ranges>
+// std::ranges::bidirectional_range std::ranges::forward_range
+// std::ranges::view std::views::reverse
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @test Verify the range meet the forward range and view concepts.
+[[maybe_unused]] constexpr auto concepts = []() {
+  using view = decltype(fcarouge::subtree(fcarouge::tree<int>::iterator{}));
+  static_assert(std::ranges::view<view>,
+                "The container's subtree range must meet the view concept.");
+  static_assert(std::ranges::forward_range<view>,
+                "The container's subtree range must meet the forward range "
+                "concept.");
+
+  return 0;
+}();
+
+//! @test Verify the subtree ranges stay within their subtree.
+[[maybe_unused]] auto bounded = []() {
+  fcarouge::tree_int granville_pine(0);
+  const auto node1 = granville_pine.push(granville_pine.begin(), 1);
+  const auto node11 = granville_pine.push(node1, 11);
+  granville_pine.push(node11, 111);
+  granville_pine.push(node1, 12);
+  const auto node2 = granville_pine.push(granville_pine.begin(), 2);
+  granville_pine.push(node2, 21);
+
+  // 0
+  // ├── 1
+  // │   ├── 11
+  // │   │   └── 111
+  // │   └── 12
+  // └── 2
+  //     └── 21
+
+  assert(std::ranges::equal(fcarouge::subtree(granville_pine.begin()),
+                            std::vector{ 0, 1, 11, 111, 12, 2, 21 }) &&
+         "The subtree of the root must be the container.");
+  assert(std::ranges::equal(fcarouge::subtree(node1),
+                            std::vector{ 1, 11, 111, 12 }) &&
+         "The subtree must not run into the right siblings.");
+  assert(std::ranges::equal(fcarouge::subtree(node11),
+                            std::vector{ 11, 111 }) &&
+         "The subtree must not run into the ancestors' siblings.");
+  assert(std::ranges::equal(fcarouge::subtree(node2), std::vector{ 2, 21 }) &&
+         "The last subtree must end with the container.");
+
+  return 0;
+}();
+
+//! @test Verify the descendants of an element are pruned from the traversal.
+[[maybe_unused]] auto skip = []() {
+  fcarouge::tree_int granville_pine(0);
+  const auto node1 = granville_pine.push(granville_pine.begin(), 1);
+  const auto node11 = granville_pine.push(node1, 11);
+  granville_pine.push(node11, 111);
+  granville_pine.push(node1, 12);
+  const auto node13 = granville_pine.push(node1, 13);
+  granville_pine.push(node13, 131);
+  granville_pine.push(granville_pine.begin(), 2);
+
+  std::vector<int> visited;
+  const auto range = fcarouge::subtree(node1);
+  for (auto position = range.begin(); position != range.end();) {
+    visited.push_back(*position);
+    if (*position == 11 || *position == 13) {
+      position.skip_subtree();
+    } else {
+      ++position;
+    }
+  }
+
+  assert((std::vector{ 1, 11, 12, 13 }) == visited &&
+         "The skipped descendants must be pruned within the subtree.");
+
+  return 0;
+}();
+
+//! @test Verify the subtree range of a container with a non-default
+//! allocator.
+[[maybe_unused]] auto allocator = []() {
+  std::pmr::monotonic_buffer_resource resource;
+  fcarouge::tree<int, std::pmr::polymorphic_allocator<int>> granville_pine{
+    std::pmr::polymorphic_allocator<int>{ &resource }
+  };
+  granville_pine.emplace(granville_pine.end(), 0);
+  const auto node1 = granville_pine.push(granville_pine.begin(), 1);
+  granville_pine.push(node1, 11);
+  granville_pine.push(granville_pine.begin(), 2);
+
+  assert(std::ranges::equal(fcarouge::subtree(node1), std::vector{ 1, 11 }) &&
+         "The subtree must stop after its last descendant.");
+  const auto range = fcarouge::subtree(granville_pine.cbegin());
+  auto position = range.begin();
+  ++position;
+  position.skip_subtree();
+  assert(2 == *position && "The skipped subtree must not be traversed.");
+
+  return 0;
+}();
+
+//! @test Verify the subtree ranges are traversed in reverse, including the
+//! subtrees ending with the container.
+[[maybe_unused]] auto reverse = []() {
+  fcarouge::tree_int granville_pine(0);
+  const auto node1 = granville_pine.push(granville_pine.begin(), 1);
+  granville_pine.push(node1, 11);
+  const auto node2 = granville_pine.push(granville_pine.begin(), 2);
+  const auto node21 = granville_pine.push(node2, 21);
+  granville_pine.push(node21, 211);
+
+  static_assert(
+      std::ranges::bidirectional_range<decltype(fcarouge::subtree(node2))>,
+      "The container's subtree range must meet the bidirectional range "
+      "concept.");
+  assert(std::ranges::equal(
+             std::views::reverse(fcarouge::subtree(granville_pine.begin())),
+             std::vector{ 211, 21, 2, 11, 1, 0 }) &&
+         "The reversed subtree of the root must be the reversed container.");
+  assert(std::ranges::equal(std::views::reverse(fcarouge::subtree(node2)),
+                            std::vector{ 211, 21, 2 }) &&
+         "The reversed subtree of the last child must start with its last "
+         "descendant.");
+  assert(std::ranges::equal(std::views::reverse(fcarouge::subtree(node1)),
+                            std::vector{ 11, 1 }) &&
+         "The reversed subtree must not run into the right siblings.");
+
+  return 0;
+}();
+
+} // namespace
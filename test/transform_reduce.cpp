@@ -0,0 +1,112 @@
+/*_______ _____  ______ ______
+ |__   __|  __ \|  ____|  ____|  Tree data structure for C++
+    | |  | |__) | |__  | |__     version 0.1.0
+    | |  |  _  /|  __| |  __|    https://github.com/FrancoisCarouge/Tree
+    | |  | | \ \| |____| |____
+    |_|  |_|  \_\______|______|
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright 2020 Francois Carouge.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "fcarouge/tree_algorithm.hpp"
+// fcarouge::transform_reduce
+
+#include "fcarouge/tree.hpp"
+// fcarouge::tree
+
+#include "fcarouge/tree_execution.hpp"
+// fcarouge::par fcarouge::parallel_policy fcarouge::seq
+
+#include <algorithm>
+// std::max
+
+#include <cassert>
+// assert
+
+#include <cstddef>
+// std::size_t
+
+#include <functional>
+// std::plus
+
+#include <string>
+// std::string
+
+#include <vector>
+// std::vector
+
+namespace
+{
+//! @brief The element type of the tests, a record of fields.
+struct record {
+  std::string name;
+  int weight = 0;
+};
+
+//! @test Verify the sum of a field of the elements.
+[[maybe_unused]] auto field = []() {
+  fcarouge::tree<record> cerisy_beech(record{ "root", 1 });
+  std::vector<fcarouge::tree<record>::iterator> positions{
+    cerisy_beech.begin()
+  };
+  int expected = 1;
+  for (int i = 1; i < 5000; ++i) {
+    positions.push_back(cerisy_beech.push(
+        positions[static_cast<std::size_t>(i - 1) / 5], record{ "", i % 7 }));
+    expected += i % 7;
+  }
+  const auto weight = [](const record &value) { return value.weight; };
+
+  assert(expected == fcarouge::transform_reduce(fcarouge::seq, cerisy_beech, 0,
+                                                std::plus<>{}, weight) &&
+         "The sequenced transform-reduction must sum the field.");
+  assert(expected == fcarouge::transform_reduce(fcarouge::par, cerisy_beech, 0,
+                                                std::plus<>{}, weight) &&
+         "The parallel transform-reduction must sum the field.");
+  assert(expected == fcarouge::transform_reduce(
+                         fcarouge::parallel_policy{ 4 }, cerisy_beech, 0,
+                         std::plus<>{}, weight) &&
+         "The parallel transform-reduction must sum the field.");
+
+  return 0;
+}();
+
+//! @test Verify the maximum of the transformed elements.
+[[maybe_unused]] auto maximum = []() {
+  fcarouge::tree<record> cerisy_beech(record{ "root", 1 });
+  cerisy_beech.push(cerisy_beech.push(cerisy_beech.begin(), record{ "a", 3 }),
+                    record{ "bb", 9 });
+  cerisy_beech.push(cerisy_beech.begin(), record{ "ccc", 4 });
+
+  const auto length = [](const record &value) { return value.name.size(); };
+  const auto max = [](std::size_t lhs, std::size_t rhs) {
+    return std::max(lhs, rhs);
+  };
+
+  assert(4 == fcarouge::transform_reduce(fcarouge::parallel_policy{ 2 },
+                                         cerisy_beech, std::size_t{ 0 }, max,
+                                         length) &&
+         "The parallel transform-reduction must use the operations.");
+
+  return 0;
+}();
+
+} // namespace